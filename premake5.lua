@@ -151,19 +151,25 @@ group ""
 -- ========================
 -- Tests
 -- ========================
+include "test/LinkerTests.lua"
 include "test/ObjCommonTests.lua"
 include "test/ObjLoadingTests.lua"
+include "test/ObjWritingTests.lua"
 include "test/ParserTestUtils.lua"
 include "test/ParserTests.lua"
 include "test/ZoneCodeGeneratorLibTests.lua"
 include "test/ZoneCommonTests.lua"
+include "test/ZoneWritingTests.lua"
 
 -- Tests group: Unit test and other tests projects
 group "Tests"
+    LinkerTests:project()
     ObjCommonTests:project()
     ObjLoadingTests:project()
+    ObjWritingTests:project()
     ParserTestUtils:project()
     ParserTests:project()
     ZoneCodeGeneratorLibTests:project()
     ZoneCommonTests:project()
+    ZoneWritingTests:project()
 group ""
\ No newline at end of file
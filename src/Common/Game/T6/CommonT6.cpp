@@ -46,11 +46,8 @@ int Common::Com_HashString(const char* str, const int len)
 
     int result = 0x1505;
     int offset = 0;
-    while(str[offset])
+    while ((len <= 0 || offset < len) && str[offset])
     {
-        if (len > 0 && offset >= len)
-            break;
-
         const int c = tolower(str[offset++]);
         result = c + 33 * result;
     }
@@ -0,0 +1,222 @@
+#include "BuildInputRecordingSearchPath.h"
+
+#include <algorithm>
+#include <limits>
+#include <streambuf>
+
+#include "Crypto.h"
+#include "ProjectBuildCache.h"
+
+namespace
+{
+    constexpr auto HASH_BUFFER_SIZE = 0x1000u;
+
+    /**
+     * \brief A stream buffer that reads from another stream and hashes its content while it is being read.
+     * Parts of the stream that were skipped or never read are hashed as well to make the hash always cover the whole file.
+     */
+    class HashingStreamBuffer final : public std::streambuf
+    {
+    public:
+        HashingStreamBuffer(std::unique_ptr<std::istream> stream, const int64_t length, std::function<void(std::string hash)> hashCallback)
+            : m_stream(std::move(stream)),
+              m_length(length),
+              m_hash_function(Crypto::CreateSHA1()),
+              m_hash_callback(std::move(hashCallback)),
+              m_stream_position(0),
+              m_buffer_position(0),
+              m_hashed_length(0),
+              m_buffer{}
+        {
+            m_hash_function->Init();
+            setg(m_buffer, m_buffer, m_buffer);
+        }
+
+        ~HashingStreamBuffer() override
+        {
+            HashUntil(std::numeric_limits<int64_t>::max());
+
+            std::vector<uint8_t> hash(m_hash_function->GetHashSize());
+            m_hash_function->Finish(hash.data());
+            m_hash_callback(ProjectBuildCache::HashToString(hash));
+        }
+
+        HashingStreamBuffer(const HashingStreamBuffer& other) = delete;
+        HashingStreamBuffer(HashingStreamBuffer&& other) noexcept = delete;
+        HashingStreamBuffer& operator=(const HashingStreamBuffer& other) = delete;
+        HashingStreamBuffer& operator=(HashingStreamBuffer&& other) noexcept = delete;
+
+    protected:
+        int_type underflow() override
+        {
+            if (gptr() < egptr())
+                return traits_type::to_int_type(*gptr());
+
+            const auto position = m_buffer_position + (egptr() - eback());
+            const auto readCount = ReadStream(position, m_buffer, sizeof(m_buffer));
+
+            m_buffer_position = position;
+            setg(m_buffer, m_buffer, m_buffer + readCount);
+
+            if (readCount <= 0)
+                return traits_type::eof();
+
+            // Data that was already read before seeking backwards is not hashed again
+            if (position + readCount > m_hashed_length)
+            {
+                const auto alreadyHashed = m_hashed_length - position;
+                m_hash_function->Process(&m_buffer[alreadyHashed], static_cast<size_t>(readCount - alreadyHashed));
+                m_hashed_length = position + readCount;
+            }
+
+            return traits_type::to_int_type(*gptr());
+        }
+
+        pos_type seekoff(const off_type off, const std::ios_base::seekdir dir, const std::ios_base::openmode mode) override
+        {
+            if (dir == std::ios_base::beg)
+                return seekpos(off, mode);
+
+            if (dir == std::ios_base::cur)
+                return seekpos(m_buffer_position + (gptr() - eback()) + off, mode);
+
+            return seekpos(m_length + off, mode);
+        }
+
+        pos_type seekpos(const pos_type pos, const std::ios_base::openmode mode) override
+        {
+            const auto position = static_cast<int64_t>(pos);
+            if (position < 0 || (mode & std::ios_base::in) == 0)
+                return pos_type(off_type(-1));
+
+            // Everything in front of the new position must be hashed before the data after it is read
+            HashUntil(position);
+
+            if (position >= m_buffer_position && position <= m_buffer_position + (egptr() - eback()))
+                setg(eback(), eback() + (position - m_buffer_position), egptr());
+            else
+            {
+                m_buffer_position = position;
+                setg(m_buffer, m_buffer, m_buffer);
+            }
+
+            return pos;
+        }
+
+    private:
+        int64_t ReadStream(const int64_t position, char* buffer, const int64_t count)
+        {
+            if (m_stream_position != position)
+            {
+                m_stream->clear();
+                m_stream->seekg(position);
+                if (m_stream->fail())
+                    return 0;
+
+                m_stream_position = position;
+            }
+
+            m_stream->read(buffer, count);
+            const auto readCount = static_cast<int64_t>(m_stream->gcount());
+            m_stream_position += readCount;
+
+            return readCount;
+        }
+
+        void HashUntil(const int64_t position)
+        {
+            char buffer[HASH_BUFFER_SIZE];
+            while (m_hashed_length < position)
+            {
+                const auto readCount = ReadStream(m_hashed_length, buffer, std::min(static_cast<int64_t>(sizeof(buffer)), position - m_hashed_length));
+                if (readCount <= 0)
+                    break;
+
+                m_hash_function->Process(buffer, static_cast<size_t>(readCount));
+                m_hashed_length += readCount;
+            }
+        }
+
+        std::unique_ptr<std::istream> m_stream;
+        int64_t m_length;
+        std::unique_ptr<IHashFunction> m_hash_function;
+        std::function<void(std::string hash)> m_hash_callback;
+
+        int64_t m_stream_position;
+        int64_t m_buffer_position;
+        int64_t m_hashed_length;
+        char m_buffer[HASH_BUFFER_SIZE];
+    };
+
+    class HashingStream final : public std::istream
+    {
+    public:
+        HashingStream(std::unique_ptr<std::istream> stream, const int64_t length, std::function<void(std::string hash)> hashCallback)
+            : std::istream(nullptr),
+              m_buffer(std::move(stream), length, std::move(hashCallback))
+        {
+            rdbuf(&m_buffer);
+        }
+
+    private:
+        HashingStreamBuffer m_buffer;
+    };
+}
+
+BuildInputRecordingSearchPath::BuildInputRecordingSearchPath(ISearchPath* searchPath)
+    : m_search_path(searchPath)
+{
+}
+
+SearchPathOpenFile BuildInputRecordingSearchPath::Open(const std::string& fileName)
+{
+    auto file = m_search_path->Open(fileName);
+    const auto isFirstOpen = m_opened_file_names.emplace(fileName).second;
+
+    if (!file.IsOpen())
+    {
+        if (isFirstOpen)
+            m_opened_files.emplace_back(OpenedFile{fileName, ProjectBuildCache::MISSING_FILE_HASH});
+
+        return file;
+    }
+
+    if (!isFirstOpen)
+        return file;
+
+    // The content is hashed while the build reads it to make sure the hash matches what the build actually read
+    const auto openedFileIndex = m_opened_files.size();
+    m_opened_files.emplace_back(OpenedFile{fileName, std::string()});
+
+    const auto length = file.m_length;
+    return SearchPathOpenFile(std::make_unique<HashingStream>(std::move(file.m_stream), length, [this, openedFileIndex](std::string hash)
+    {
+        m_opened_files[openedFileIndex].m_hash = std::move(hash);
+    }), length);
+}
+
+std::string BuildInputRecordingSearchPath::GetPath()
+{
+    return m_search_path->GetPath();
+}
+
+void BuildInputRecordingSearchPath::Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback)
+{
+    auto hash = ProjectBuildCache::FindAndHashFiles(m_search_path, options, callback);
+    m_find_calls.emplace_back(FindCall{options, std::move(hash)});
+}
+
+ISearchPath* BuildInputRecordingSearchPath::GetSearchPath() const
+{
+    return m_search_path;
+}
+
+const std::vector<BuildInputRecordingSearchPath::OpenedFile>& BuildInputRecordingSearchPath::GetOpenedFiles() const
+{
+    return m_opened_files;
+}
+
+const std::vector<BuildInputRecordingSearchPath::FindCall>& BuildInputRecordingSearchPath::GetFindCalls() const
+{
+    return m_find_calls;
+}
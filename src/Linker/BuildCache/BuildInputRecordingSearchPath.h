@@ -0,0 +1,48 @@
+#pragma once
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "Utils/ClassUtils.h"
+#include "SearchPath/ISearchPath.h"
+
+/**
+ * \brief A search path that forwards to another search path and records every file that is opened through it together with a hash of its content.
+ * Files that could not be found are recorded as well since them appearing later changes the result of a build too.
+ * The hash of an opened file is only complete once its stream was closed, so streams must not outlive the search path.
+ */
+class BuildInputRecordingSearchPath final : public ISearchPath
+{
+public:
+    class OpenedFile
+    {
+    public:
+        std::string m_name;
+        // ProjectBuildCache::MISSING_FILE_HASH when the file could not be found, empty while the file is still open
+        std::string m_hash;
+    };
+
+    class FindCall
+    {
+    public:
+        SearchPathSearchOptions m_options;
+        std::string m_hash;
+    };
+
+    explicit BuildInputRecordingSearchPath(ISearchPath* searchPath);
+
+    SearchPathOpenFile Open(const std::string& fileName) override;
+    std::string GetPath() override;
+    void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override;
+
+    _NODISCARD ISearchPath* GetSearchPath() const;
+    _NODISCARD const std::vector<OpenedFile>& GetOpenedFiles() const;
+    _NODISCARD const std::vector<FindCall>& GetFindCalls() const;
+
+private:
+    ISearchPath* m_search_path;
+    std::vector<OpenedFile> m_opened_files;
+    std::unordered_set<std::string> m_opened_file_names;
+    std::vector<FindCall> m_find_calls;
+};
@@ -0,0 +1,230 @@
+#include "ProjectBuildCache.h"
+
+#include <fstream>
+#include <iostream>
+
+#include "Crypto.h"
+
+namespace
+{
+    constexpr auto HASH_READ_BUFFER_SIZE = 0x10000u;
+
+    /**
+     * \brief Splits a line into fields that are separated by a single space. The last field contains the remainder of the line and may contain spaces itself.
+     * \return \c true if the line contains the specified amount of fields, otherwise \c false.
+     */
+    bool SplitFields(const std::string& line, const size_t fieldCount, std::vector<std::string>& fields)
+    {
+        fields.clear();
+
+        size_t fieldStart = 0u;
+        while (fields.size() + 1u < fieldCount)
+        {
+            const auto separator = line.find(' ', fieldStart);
+            if (separator == std::string::npos)
+                return false;
+
+            fields.emplace_back(line, fieldStart, separator - fieldStart);
+            fieldStart = separator + 1u;
+        }
+
+        fields.emplace_back(line, fieldStart);
+        return true;
+    }
+
+    std::string SearchOptionsToString(const SearchPathSearchOptions& options)
+    {
+        std::string result;
+        result.push_back(options.m_should_include_subdirectories ? '1' : '0');
+        result.push_back(options.m_disk_files_only ? '1' : '0');
+        result.push_back(options.m_absolute_paths ? '1' : '0');
+        result.push_back(options.m_filter_extensions ? '1' : '0');
+
+        return result;
+    }
+
+    bool SearchOptionsFromString(const std::string& str, const std::string& extension, SearchPathSearchOptions& options)
+    {
+        if (str.size() != 4u)
+            return false;
+
+        options.IncludeSubdirectories(str[0] == '1');
+        options.OnlyDiskFiles(str[1] == '1');
+        options.AbsolutePaths(str[2] == '1');
+
+        if (str[3] == '1')
+            options.FilterExtensions(extension);
+
+        return true;
+    }
+}
+
+ProjectBuildCache::ProjectBuildCache(std::string cacheFilePath, std::vector<std::string> settings)
+    : m_cache_file_path(std::move(cacheFilePath)),
+      m_settings(std::move(settings))
+{
+}
+
+bool ProjectBuildCache::IsUpToDate(const std::map<std::string, BuildInputRecordingSearchPath*>& buildInputs) const
+{
+    std::ifstream stream(m_cache_file_path, std::fstream::in);
+    if (!stream.is_open())
+        return false;
+
+    std::string line;
+    if (!std::getline(stream, line) || line != FILE_HEADER)
+        return false;
+
+    auto settingIndex = 0u;
+    std::vector<std::string> fields;
+    std::vector<std::string> lineFields;
+    while (std::getline(stream, line))
+    {
+        if (!SplitFields(line, 2u, lineFields))
+            return false;
+
+        const auto& type = lineFields[0];
+        const auto& content = lineFields[1];
+
+        if (type == "setting")
+        {
+            if (settingIndex >= m_settings.size() || m_settings[settingIndex++] != content)
+                return false;
+        }
+        else if (type == "output")
+        {
+            // output <hash> <path>
+            if (!SplitFields(content, 2u, fields) || HashFile(fields[1]) != fields[0])
+                return false;
+        }
+        else if (type == "open")
+        {
+            // open <searchPath> <hash> <fileName>
+            if (!SplitFields(content, 3u, fields))
+                return false;
+
+            const auto searchPath = buildInputs.find(fields[0]);
+            if (searchPath == buildInputs.end() || HashOpenedFile(searchPath->second->GetSearchPath(), fields[2]) != fields[1])
+                return false;
+        }
+        else if (type == "find")
+        {
+            // find <searchPath> <options> <hash> <extension>
+            SearchPathSearchOptions options;
+            if (!SplitFields(content, 4u, fields) || !SearchOptionsFromString(fields[1], fields[3], options))
+                return false;
+
+            const auto searchPath = buildInputs.find(fields[0]);
+            if (searchPath == buildInputs.end()
+                || FindAndHashFiles(searchPath->second->GetSearchPath(), options, [](const std::string&)
+                {
+                }) != fields[2])
+                return false;
+        }
+        else
+            return false;
+    }
+
+    return settingIndex == m_settings.size();
+}
+
+bool ProjectBuildCache::Write(const std::map<std::string, BuildInputRecordingSearchPath*>& buildInputs, const std::string& outputFilePath) const
+{
+    std::ofstream stream(m_cache_file_path, std::fstream::out);
+    if (!stream.is_open())
+    {
+        std::cout << "Failed to write build cache \"" << m_cache_file_path << "\"\n";
+        return false;
+    }
+
+    stream << FILE_HEADER << "\n";
+
+    for (const auto& setting : m_settings)
+        stream << "setting " << setting << "\n";
+
+    stream << "output " << HashFile(outputFilePath) << " " << outputFilePath << "\n";
+
+    for (const auto& [searchPathName, searchPath] : buildInputs)
+    {
+        for (const auto& openedFile : searchPath->GetOpenedFiles())
+            stream << "open " << searchPathName << " " << openedFile.m_hash << " " << openedFile.m_name << "\n";
+
+        for (const auto& findCall : searchPath->GetFindCalls())
+            stream << "find " << searchPathName << " " << SearchOptionsToString(findCall.m_options) << " " << findCall.m_hash << " " << findCall.m_options.m_extension << "\n";
+    }
+
+    return true;
+}
+
+std::string ProjectBuildCache::HashToString(const std::vector<uint8_t>& hash)
+{
+    static constexpr const char* HEX_DIGITS = "0123456789abcdef";
+
+    std::string result;
+    result.reserve(hash.size() * 2u);
+    for (const auto byte : hash)
+    {
+        result.push_back(HEX_DIGITS[byte >> 4]);
+        result.push_back(HEX_DIGITS[byte & 0xF]);
+    }
+
+    return result;
+}
+
+std::string ProjectBuildCache::HashData(const void* data, const size_t dataSize)
+{
+    const auto hashFunction = Crypto::CreateSHA1();
+    hashFunction->Init();
+    hashFunction->Process(data, dataSize);
+
+    std::vector<uint8_t> hash(hashFunction->GetHashSize());
+    hashFunction->Finish(hash.data());
+
+    return HashToString(hash);
+}
+
+std::string ProjectBuildCache::HashStream(std::istream& stream)
+{
+    const auto hashFunction = Crypto::CreateSHA1();
+    hashFunction->Init();
+
+    std::vector<char> buffer(HASH_READ_BUFFER_SIZE);
+    while (stream.read(buffer.data(), static_cast<std::streamsize>(buffer.size())) || stream.gcount() > 0)
+        hashFunction->Process(buffer.data(), static_cast<size_t>(stream.gcount()));
+
+    std::vector<uint8_t> hash(hashFunction->GetHashSize());
+    hashFunction->Finish(hash.data());
+
+    return HashToString(hash);
+}
+
+std::string ProjectBuildCache::FindAndHashFiles(ISearchPath* searchPath, const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback)
+{
+    std::string foundFiles;
+    searchPath->Find(options, [&foundFiles, &callback](const std::string& path)
+    {
+        foundFiles.append(path);
+        foundFiles.push_back('\0');
+        callback(path);
+    });
+
+    return HashData(foundFiles.data(), foundFiles.size());
+}
+
+std::string ProjectBuildCache::HashFile(const std::string& filePath)
+{
+    std::ifstream stream(filePath, std::fstream::in | std::fstream::binary);
+    if (!stream.is_open())
+        return MISSING_FILE_HASH;
+
+    return HashStream(stream);
+}
+
+std::string ProjectBuildCache::HashOpenedFile(ISearchPath* searchPath, const std::string& fileName)
+{
+    const auto file = searchPath->Open(fileName);
+    if (!file.IsOpen())
+        return MISSING_FILE_HASH;
+
+    return HashStream(*file.m_stream);
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Utils/ClassUtils.h"
+#include "BuildInputRecordingSearchPath.h"
+
+/**
+ * \brief Remembers the inputs a project was built from to be able to skip building it again when none of them changed.
+ * The inputs are the files opened and searched for through the search paths of the build, settings that influence the build and the created zone file.
+ * The cache is a text file that lists every input together with a hash of its content.
+ */
+class ProjectBuildCache
+{
+public:
+    static constexpr const char* FILE_HEADER = "OAT_BUILD_CACHE 1";
+    static constexpr const char* MISSING_FILE_HASH = "-";
+
+    /**
+     * \brief Creates a build cache for a project.
+     * \param cacheFilePath The path of the file the cache is read from and written to.
+     * \param settings Settings that influence the build. When one of them differs from the last build, the project is not up to date.
+     */
+    ProjectBuildCache(std::string cacheFilePath, std::vector<std::string> settings);
+
+    /**
+     * \brief Checks whether the last build of the project used the same settings and inputs and created the zone file that exists right now.
+     * \param buildInputs The search paths of the current build by name. Recorded inputs are checked by opening them again with the search path of the same name.
+     * \return \c true if the project does not need to be built again, otherwise \c false.
+     */
+    _NODISCARD bool IsUpToDate(const std::map<std::string, BuildInputRecordingSearchPath*>& buildInputs) const;
+
+    /**
+     * \brief Writes the inputs of a successful build to the cache file.
+     * \param buildInputs The search paths that recorded the inputs of the build by name.
+     * \param outputFilePath The path of the zone file that was created.
+     * \return \c true if the cache file could be written, otherwise \c false.
+     */
+    bool Write(const std::map<std::string, BuildInputRecordingSearchPath*>& buildInputs, const std::string& outputFilePath) const;
+
+    _NODISCARD static std::string HashToString(const std::vector<uint8_t>& hash);
+    _NODISCARD static std::string HashData(const void* data, size_t dataSize);
+    _NODISCARD static std::string HashStream(std::istream& stream);
+
+    /**
+     * \brief Searches for files in a search path and hashes the list of found files.
+     */
+    static std::string FindAndHashFiles(ISearchPath* searchPath, const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback);
+
+private:
+    _NODISCARD static std::string HashFile(const std::string& filePath);
+    _NODISCARD static std::string HashOpenedFile(ISearchPath* searchPath, const std::string& fileName);
+
+    std::string m_cache_file_path;
+    std::vector<std::string> m_settings;
+};
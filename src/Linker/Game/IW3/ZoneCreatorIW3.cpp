@@ -75,7 +75,7 @@ std::unique_ptr<Zone> ZoneCreator::CreateZoneForDefinition(ZoneCreationContext&
         context.m_ignored_assets.emplace_back(assetEntry.m_asset_type, assetEntry.m_asset_name);
     }
 
-    const auto assetLoadingContext = std::make_unique<AssetLoadingContext>(zone.get(), context.m_asset_search_path, CreateGdtList(context));
+    const auto assetLoadingContext = std::make_unique<AssetLoadingContext>(zone.get(), context.m_asset_search_path, CreateGdtList(context), context.m_asset_loading_session);
     if (!CreateIgnoredAssetMap(context, assetLoadingContext->m_ignored_asset_map))
         return nullptr;
 
@@ -92,7 +92,8 @@ std::unique_ptr<Zone> ZoneCreator::CreateZoneForDefinition(ZoneCreationContext&
             return nullptr;
     }
 
-    ObjLoading::FinalizeAssetsForZone(assetLoadingContext.get());
+    if (!ObjLoading::FinalizeAssetsForZone(assetLoadingContext.get()))
+        return nullptr;
 
     return zone;
 }
@@ -1,12 +1,21 @@
 #include "Linker.h"
 
+#include <algorithm>
 #include <set>
 #include <regex>
 #include <filesystem>
 #include <fstream>
 #include <deque>
+#include <atomic>
+#include <mutex>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+#include <cstring>
 
 #include "Utils/ClassUtils.h"
+#include "Utils/FileUtils.h"
+#include "Utils/TaskPool.h"
 #include "Utils/Arguments/ArgumentParser.h"
 #include "ZoneLoading.h"
 #include "ObjWriting.h"
@@ -15,6 +24,7 @@
 #include "SearchPath/SearchPathFilesystem.h"
 #include "ObjContainer/IWD/IWD.h"
 #include "LinkerArgs.h"
+#include "BuildCache/ProjectBuildCache.h"
 #include "ZoneWriting.h"
 #include "Game/IW3/ZoneCreatorIW3.h"
 #include "ZoneCreation/ZoneCreationContext.h"
@@ -45,13 +55,45 @@ class Linker::Impl
     static constexpr const char* METADATA_NAME = "name";
     static constexpr const char* METADATA_GAME = "game";
     static constexpr const char* METADATA_GDT = "gdt";
+    static constexpr size_t FILE_COMPARE_BUFFER_SIZE = 0x10000;
 
     LinkerArgs m_args;
-    std::vector<std::unique_ptr<ISearchPath>> m_loaded_project_search_paths;
+    std::string m_linker_stamp;
+    std::vector<ISearchPath*> m_project_independent_iwd_search_paths;
+    std::vector<std::string> m_project_independent_iwd_paths;
     SearchPaths m_asset_search_paths;
     SearchPaths m_gdt_search_paths;
     SearchPaths m_source_search_paths;
-    std::vector<std::unique_ptr<Zone>> m_loaded_zones;
+
+    class LoadedZone
+    {
+    public:
+        std::unique_ptr<Zone> m_zone;
+        std::string m_file_path;
+
+        // Stamp of the zone file at the time it was loaded, the file on disk may have changed since then
+        std::string m_stamp;
+    };
+
+    std::vector<LoadedZone> m_loaded_zones;
+
+    // State of asset loaders that is shared by all projects that are built, like parsed techset files
+    std::unique_ptr<AssetLoadingSession> m_asset_loading_session;
+
+    class KeptSearchPath
+    {
+    public:
+        SearchPathFilesystem* m_search_path;
+        bool m_has_iwds;
+        std::string m_iwd_stamp;
+    };
+
+    // Search paths that stay loaded between the builds of batch mode
+    std::vector<KeptSearchPath> m_kept_search_paths;
+    std::unordered_map<std::string, std::unique_ptr<SearchPathFilesystem>> m_kept_project_asset_search_paths;
+
+    // Guards the IWD repository which is shared by all projects that are being built
+    mutable std::mutex m_iwd_mutex;
 
     /**
      * \brief Loads a search path.
@@ -64,6 +106,7 @@ class Linker::Impl
             printf("Loading search path: \"%s\"\n", searchPath->GetPath().c_str());
         }
 
+        std::lock_guard<std::mutex> lock(m_iwd_mutex);
         ObjLoading::LoadIWDsInSearchPath(searchPath);
     }
 
@@ -78,12 +121,103 @@ class Linker::Impl
             printf("Unloading search path: \"%s\"\n", searchPath->GetPath().c_str());
         }
 
+        std::lock_guard<std::mutex> lock(m_iwd_mutex);
         ObjLoading::UnloadIWDsInSearchPath(searchPath);
     }
 
-    SearchPaths GetAssetSearchPathsForProject(const std::string& gameName, const std::string& projectName)
+    /**
+     * \brief Creates a search path for a directory with inputs of the Linker.
+     * Inputs are not expected to change during a build, so the files of the directory are indexed to make looking up missing files cheap.
+     * Batch mode invalidates the index of search paths that are kept between builds.
+     */
+    static std::unique_ptr<SearchPathFilesystem> CreateInputSearchPath(const std::string& path)
+    {
+        auto searchPath = std::make_unique<SearchPathFilesystem>(path);
+        searchPath->SetUseFileIndex(true);
+
+        return searchPath;
+    }
+
+    /**
+     * \brief Identifies the IWDs of a search path by their names, sizes and last write times to be able to tell when they changed.
+     */
+    static std::string GetIWDStamp(ISearchPath* searchPath)
+    {
+        std::ostringstream ss;
+        searchPath->Find(SearchPathSearchOptions().IncludeSubdirectories(false).FilterExtensions("iwd"), [&ss](const std::string& path)
+        {
+            std::error_code ec;
+            const auto fileSize = fs::file_size(path, ec);
+            const auto lastWriteTime = fs::last_write_time(path, ec);
+            ss << path << ":" << fileSize << ":" << lastWriteTime.time_since_epoch().count() << "\n";
+        });
+
+        return ss.str();
+    }
+
+    /**
+     * \brief Remembers a search path that stays loaded between the builds of batch mode, so it can be refreshed before every build.
+     */
+    void KeepSearchPath(SearchPathFilesystem* searchPath, const bool hasIWDs)
+    {
+        if (!m_args.m_batch)
+            return;
+
+        m_kept_search_paths.emplace_back(KeptSearchPath{searchPath, hasIWDs, hasIWDs ? GetIWDStamp(searchPath) : std::string()});
+    }
+
+    /**
+     * \brief Makes the search paths that are kept between builds notice changed files. Their IWDs are only loaded again when IWDs were added, removed or changed.
+     */
+    void RefreshKeptSearchPaths()
+    {
+        for (auto& keptSearchPath : m_kept_search_paths)
+        {
+            keptSearchPath.m_search_path->InvalidateFileIndex();
+
+            if (!keptSearchPath.m_has_iwds)
+                continue;
+
+            auto iwdStamp = GetIWDStamp(keptSearchPath.m_search_path);
+            if (iwdStamp == keptSearchPath.m_iwd_stamp)
+                continue;
+
+            UnloadSearchPath(keptSearchPath.m_search_path);
+            LoadSearchPath(keptSearchPath.m_search_path);
+            keptSearchPath.m_iwd_stamp = std::move(iwdStamp);
+        }
+    }
+
+    /**
+     * \brief Returns the loaded asset search path of a project that is kept between the builds of batch mode.
+     */
+    SearchPathFilesystem* GetKeptProjectAssetSearchPath(const std::string& path)
+    {
+        const auto foundSearchPath = m_kept_project_asset_search_paths.find(path);
+        if (foundSearchPath != m_kept_project_asset_search_paths.end())
+            return foundSearchPath->second.get();
+
+        auto searchPath = CreateInputSearchPath(path);
+        auto* searchPathPtr = searchPath.get();
+        LoadSearchPath(searchPathPtr);
+        KeepSearchPath(searchPathPtr, true);
+        m_kept_project_asset_search_paths.emplace(std::make_pair(path, std::move(searchPath)));
+
+        return searchPathPtr;
+    }
+
+    SearchPaths GetAssetSearchPathsForProject(const std::string& gameName, const std::string& projectName, std::vector<std::unique_ptr<ISearchPath>>& loadedSearchPaths)
     {
         SearchPaths searchPathsForProject;
+        auto iwdSearchPaths = m_project_independent_iwd_search_paths;
+
+        for (const auto& path : m_project_independent_iwd_paths)
+        {
+            auto searchPath = CreateInputSearchPath(path);
+            LoadSearchPath(searchPath.get());
+            iwdSearchPaths.push_back(searchPath.get());
+            loadedSearchPaths.emplace_back(std::move(searchPath));
+        }
 
         for (const auto& searchPathStr : m_args.GetAssetSearchPathsForProject(gameName, projectName))
         {
@@ -99,17 +233,31 @@ class Linker::Impl
             if (m_args.m_verbose)
                 std::cout << "Adding asset search path: " << absolutePath.string() << std::endl;
 
-            auto searchPath = std::make_unique<SearchPathFilesystem>(searchPathStr);
+            // Batch mode keeps the search paths of projects loaded so following builds do not need to load their IWDs again.
+            // When building multiple projects at the same time every project needs its own IWD instances though.
+            if (m_args.m_batch && m_args.m_job_count <= 1)
+            {
+                auto* keptSearchPath = GetKeptProjectAssetSearchPath(absolutePath.string());
+                searchPathsForProject.IncludeSearchPath(keptSearchPath);
+                iwdSearchPaths.push_back(keptSearchPath);
+                continue;
+            }
+
+            auto searchPath = CreateInputSearchPath(searchPathStr);
             LoadSearchPath(searchPath.get());
             searchPathsForProject.IncludeSearchPath(searchPath.get());
-            m_loaded_project_search_paths.emplace_back(std::move(searchPath));
+            iwdSearchPaths.push_back(searchPath.get());
+            loadedSearchPaths.emplace_back(std::move(searchPath));
         }
 
         searchPathsForProject.IncludeSearchPath(&m_asset_search_paths);
 
-        for (auto* iwd : IWD::Repository)
+        // Only use the IWDs of this project since other projects may be built at the same time
+        std::lock_guard<std::mutex> lock(m_iwd_mutex);
+        for (auto* iwdSearchPath : iwdSearchPaths)
         {
-            searchPathsForProject.IncludeSearchPath(iwd);
+            for (auto* iwd : IWD::Repository.GetContainersReferencedBy(iwdSearchPath))
+                searchPathsForProject.IncludeSearchPath(iwd);
         }
 
         return searchPathsForProject;
@@ -133,7 +281,7 @@ class Linker::Impl
             if (m_args.m_verbose)
                 std::cout << "Adding gdt search path: " << absolutePath.string() << std::endl;
 
-            searchPathsForProject.CommitSearchPath(std::make_unique<SearchPathFilesystem>(searchPathStr));
+            searchPathsForProject.CommitSearchPath(CreateInputSearchPath(searchPathStr));
         }
 
         searchPathsForProject.IncludeSearchPath(&m_gdt_search_paths);
@@ -159,7 +307,7 @@ class Linker::Impl
             if (m_args.m_verbose)
                 std::cout << "Adding source search path: " << absolutePath.string() << std::endl;
 
-            searchPathsForProject.CommitSearchPath(std::make_unique<SearchPathFilesystem>(searchPathStr));
+            searchPathsForProject.CommitSearchPath(CreateInputSearchPath(searchPathStr));
         }
 
         searchPathsForProject.IncludeSearchPath(&m_source_search_paths);
@@ -187,8 +335,20 @@ class Linker::Impl
             if (m_args.m_verbose)
                 std::cout << "Adding asset search path: " << absolutePath.string() << std::endl;
 
-            auto searchPath = std::make_unique<SearchPathFilesystem>(absolutePath.string());
-            LoadSearchPath(searchPath.get());
+            auto searchPath = CreateInputSearchPath(absolutePath.string());
+
+            // IWDs can only have one file open at a time so when building projects at the same time every project loads its own instances
+            if (m_args.m_job_count > 1)
+            {
+                m_project_independent_iwd_paths.emplace_back(absolutePath.string());
+            }
+            else
+            {
+                LoadSearchPath(searchPath.get());
+                m_project_independent_iwd_search_paths.push_back(searchPath.get());
+            }
+
+            KeepSearchPath(searchPath.get(), m_args.m_job_count <= 1);
             m_asset_search_paths.CommitSearchPath(std::move(searchPath));
         }
 
@@ -206,7 +366,9 @@ class Linker::Impl
             if (m_args.m_verbose)
                 std::cout << "Adding gdt search path: " << absolutePath.string() << std::endl;
 
-            m_gdt_search_paths.CommitSearchPath(std::make_unique<SearchPathFilesystem>(absolutePath.string()));
+            auto searchPath = CreateInputSearchPath(absolutePath.string());
+            KeepSearchPath(searchPath.get(), false);
+            m_gdt_search_paths.CommitSearchPath(std::move(searchPath));
         }
 
         for (const auto& path : m_args.GetProjectIndependentSourceSearchPaths())
@@ -223,7 +385,9 @@ class Linker::Impl
             if (m_args.m_verbose)
                 std::cout << "Adding source search path: " << absolutePath.string() << std::endl;
 
-            m_source_search_paths.CommitSearchPath(std::make_unique<SearchPathFilesystem>(absolutePath.string()));
+            auto searchPath = CreateInputSearchPath(absolutePath.string());
+            KeepSearchPath(searchPath.get(), false);
+            m_source_search_paths.CommitSearchPath(std::move(searchPath));
         }
 
         return true;
@@ -344,7 +508,7 @@ class Linker::Impl
 
             if (assetListStream.IsOpen())
             {
-                const AssetListInputStream stream(*assetListStream.m_stream);
+                AssetListInputStream stream(*assetListStream.m_stream);
                 AssetListEntry entry;
 
                 while (stream.NextEntry(entry))
@@ -457,6 +621,7 @@ class Linker::Impl
                                                   ISearchPath* sourceSearchPath) const
     {
         const auto context = std::make_unique<ZoneCreationContext>(assetSearchPath, &zoneDefinition);
+        context->m_asset_loading_session = m_asset_loading_session.get();
         if (!ProcessZoneDefinitionIgnores(projectName, *context, sourceSearchPath))
             return nullptr;
         if (!GetGameNameFromZoneDefinition(context->m_game_name, projectName, zoneDefinition))
@@ -473,15 +638,48 @@ class Linker::Impl
         return nullptr;
     }
 
-    bool WriteZoneToFile(const std::string& projectName, Zone* zone) const
+    static bool FilesAreEqual(const fs::path& path1, const fs::path& path2)
+    {
+        std::error_code ec;
+        const auto size1 = fs::file_size(path1, ec);
+        if (ec)
+            return false;
+        const auto size2 = fs::file_size(path2, ec);
+        if (ec || size1 != size2)
+            return false;
+
+        std::ifstream stream1(path1, std::fstream::in | std::fstream::binary);
+        std::ifstream stream2(path2, std::fstream::in | std::fstream::binary);
+        if (!stream1.is_open() || !stream2.is_open())
+            return false;
+
+        std::vector<char> buffer1(FILE_COMPARE_BUFFER_SIZE);
+        std::vector<char> buffer2(FILE_COMPARE_BUFFER_SIZE);
+        while (stream1.read(buffer1.data(), static_cast<std::streamsize>(buffer1.size())) || stream1.gcount() > 0)
+        {
+            const auto readSize = stream1.gcount();
+            if (!stream2.read(buffer2.data(), readSize) || std::memcmp(buffer1.data(), buffer2.data(), static_cast<size_t>(readSize)) != 0)
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * \brief Writes a zone to its file in the output folder of the project.
+     * The zone is written to a temporary file first, so the existing zone file stays untouched when writing fails or the written zone did not change.
+     */
+    bool WriteZoneToFile(const std::string& projectName, Zone* zone, std::string& zoneFilePathOut) const
     {
         const fs::path zoneFolderPath(m_args.GetOutputFolderPathForProject(projectName));
         auto zoneFilePath(zoneFolderPath);
         zoneFilePath.append(zone->m_name + ".ff");
+        auto tempZoneFilePath(zoneFilePath);
+        tempZoneFilePath += ".tmp";
 
         fs::create_directories(zoneFolderPath);
 
-        std::ofstream stream(zoneFilePath, std::fstream::out | std::fstream::binary);
+        std::ofstream stream(tempZoneFilePath, std::fstream::out | std::fstream::binary);
         if (!stream.is_open())
             return false;
 
@@ -489,20 +687,75 @@ class Linker::Impl
         {
             std::cout << "Writing zone failed." << std::endl;
             stream.close();
+            fs::remove(tempZoneFilePath);
             return false;
         }
 
-        std::cout << "Created zone \"" << zoneFilePath.string() << "\"\n";
-
         stream.close();
+        zoneFilePathOut = zoneFilePath.string();
+
+        if (FilesAreEqual(tempZoneFilePath, zoneFilePath))
+        {
+            fs::remove(tempZoneFilePath);
+            std::cout << "Zone \"" << zoneFilePath.string() << "\" did not change\n";
+            return true;
+        }
+
+        std::error_code ec;
+        fs::rename(tempZoneFilePath, zoneFilePath, ec);
+        if (ec)
+        {
+            std::cout << "Failed to replace zone \"" << zoneFilePath.string() << "\": " << ec.message() << "\n";
+            fs::remove(tempZoneFilePath);
+            return false;
+        }
+
+        std::cout << "Created zone \"" << zoneFilePath.string() << "\"\n";
         return true;
     }
 
+    static std::string GetFileStamp(const std::string& filePath)
+    {
+        std::error_code ec;
+        const auto fileSize = fs::file_size(filePath, ec);
+        if (ec)
+            return ProjectBuildCache::MISSING_FILE_HASH;
+
+        const auto lastWriteTime = fs::last_write_time(filePath, ec);
+        if (ec)
+            return ProjectBuildCache::MISSING_FILE_HASH;
+
+        return std::to_string(fileSize) + ":" + std::to_string(lastWriteTime.time_since_epoch().count());
+    }
+
+    /**
+     * \brief Collects everything besides the files read through search paths that influences the result of building a project.
+     * The linker itself and loaded zones are identified by their size and last write time since they are too large to be hashed on every build.
+     * For loaded zones that is the stamp taken when they were loaded, since the project is built against the zone in memory and not the file on disk.
+     */
+    _NODISCARD std::vector<std::string> GetBuildSettings() const
+    {
+        std::vector<std::string> settings;
+
+        settings.emplace_back("linker " + m_linker_stamp);
+        settings.emplace_back("menu-permissive " + std::to_string(ObjLoading::Configuration.MenuPermissiveParsing));
+        settings.emplace_back("menu-no-optimization " + std::to_string(ObjLoading::Configuration.MenuNoOptimization));
+
+        for (const auto& loadedZone : m_loaded_zones)
+            settings.emplace_back("load " + loadedZone.m_stamp + " " + fs::absolute(loadedZone.m_file_path).string());
+
+        return settings;
+    }
+
     bool BuildProject(const std::string& projectName)
     {
         auto sourceSearchPaths = GetSourceSearchPathsForProject(projectName);
 
-        const auto zoneDefinition = ReadZoneDefinition(projectName, &sourceSearchPaths);
+        // Inputs are only recorded for incremental builds since recording hashes every file that is read
+        BuildInputRecordingSearchPath sourceInputs(&sourceSearchPaths);
+        ISearchPath* sourceSearchPath = m_args.m_incremental ? static_cast<ISearchPath*>(&sourceInputs) : &sourceSearchPaths;
+
+        const auto zoneDefinition = ReadZoneDefinition(projectName, sourceSearchPath);
         if (!zoneDefinition)
             return false;
 
@@ -513,23 +766,129 @@ class Linker::Impl
         for (auto& c : gameName)
             c = static_cast<char>(std::tolower(c));
 
-        auto assetSearchPaths = GetAssetSearchPathsForProject(gameName, projectName);
+        std::vector<std::unique_ptr<ISearchPath>> loadedSearchPaths;
+        auto assetSearchPaths = GetAssetSearchPathsForProject(gameName, projectName, loadedSearchPaths);
         auto gdtSearchPaths = GetGdtSearchPathsForProject(gameName, projectName);
 
-        const auto zone = CreateZoneForDefinition(projectName, *zoneDefinition, &assetSearchPaths, &gdtSearchPaths, &sourceSearchPaths);
-        auto result = zone != nullptr;
-        if (zone)
-            result = WriteZoneToFile(projectName, zone.get());
+        BuildInputRecordingSearchPath assetInputs(&assetSearchPaths);
+        BuildInputRecordingSearchPath gdtInputs(&gdtSearchPaths);
+        ISearchPath* assetSearchPath = m_args.m_incremental ? static_cast<ISearchPath*>(&assetInputs) : &assetSearchPaths;
+        ISearchPath* gdtSearchPath = m_args.m_incremental ? static_cast<ISearchPath*>(&gdtInputs) : &gdtSearchPaths;
+        const std::map<std::string, BuildInputRecordingSearchPath*> buildInputs
+        {
+            {"source", &sourceInputs},
+            {"asset", &assetInputs},
+            {"gdt", &gdtInputs}
+        };
+
+        std::unique_ptr<ProjectBuildCache> buildCache;
+        if (m_args.m_incremental)
+        {
+            auto cacheFilePath = fs::path(m_args.GetOutputFolderPathForProject(projectName));
+            cacheFilePath.append(projectName + ".buildcache");
+            buildCache = std::make_unique<ProjectBuildCache>(cacheFilePath.string(), GetBuildSettings());
+        }
 
-        for (const auto& loadedSearchPath : m_loaded_project_search_paths)
+        auto result = false;
+        if (buildCache && buildCache->IsUpToDate(buildInputs))
+        {
+            std::cout << "Project \"" << projectName << "\" is up to date\n";
+            result = true;
+        }
+        else
+        {
+            const auto zone = CreateZoneForDefinition(projectName, *zoneDefinition, assetSearchPath, gdtSearchPath, sourceSearchPath);
+            std::string zoneFilePath;
+            result = zone != nullptr;
+            if (zone)
+                result = WriteZoneToFile(projectName, zone.get(), zoneFilePath);
+
+            if (result && buildCache)
+                buildCache->Write(buildInputs, zoneFilePath);
+        }
+
+        for (const auto& loadedSearchPath : loadedSearchPaths)
         {
             UnloadSearchPath(loadedSearchPath.get());
         }
-        m_loaded_project_search_paths.clear();
 
         return result;
     }
 
+    /**
+     * \brief Builds all projects with up to the specified amount of jobs at the same time.
+     * When a project fails to build, projects that did not start building yet are skipped.
+     * \return \c true if all projects were built successfully, otherwise \c false.
+     */
+    bool BuildProjects(const std::vector<std::string>& projectNames)
+    {
+        std::atomic_bool result = true;
+
+        const auto jobCount = std::min(m_args.m_job_count, static_cast<unsigned>(projectNames.size()));
+
+        // Zones of the projects use thread pools as well, so all of them together must not use more than the hardware threads
+        if (jobCount > 1)
+            TaskPool::SetDefaultThreadCount(std::max(TaskPool::HardwareThreadCount() / jobCount, 1u));
+        else
+            TaskPool::SetDefaultThreadCount(0u);
+
+        TaskPool taskPool(jobCount);
+        for (const auto& projectName : projectNames)
+        {
+            taskPool.Enqueue([this, &projectName, &result]
+            {
+                if (result && !BuildProject(projectName))
+                    result = false;
+            });
+        }
+        taskPool.WaitForCompletion();
+
+        return result;
+    }
+
+    /**
+     * \brief Builds the projects named on every line that is read from stdin until stdin is closed.
+     * Loaded zones, search paths and their IWDs as well as parsed files are kept between builds, so a build only pays for what changed.
+     * Loaded zones and IWDs are loaded again before a build when their files changed.
+     * After every line a line that states whether the build succeeded is printed.
+     * \return \c true if all builds succeeded, otherwise \c false.
+     */
+    bool RunBatch()
+    {
+        auto result = true;
+
+        std::string line;
+        while (std::getline(std::cin, line))
+        {
+            std::istringstream lineStream(line);
+            std::vector<std::string> projectNames;
+            std::string projectName;
+            while (lineStream >> projectName)
+                projectNames.emplace_back(std::move(projectName));
+
+            if (projectNames.empty())
+                continue;
+
+            RefreshKeptSearchPaths();
+
+            const auto buildResult = RefreshLoadedZones() && BuildProjects(projectNames);
+            std::cout << (buildResult ? "Build succeeded" : "Build failed") << std::endl;
+
+            result = result && buildResult;
+        }
+
+        return result;
+    }
+
+    void UnloadKeptProjectSearchPaths()
+    {
+        for (const auto& [path, searchPath] : m_kept_project_asset_search_paths)
+            UnloadSearchPath(searchPath.get());
+
+        m_kept_project_asset_search_paths.clear();
+        m_kept_search_paths.clear();
+    }
+
     bool LoadZones()
     {
         for (const auto& zonePath : m_args.m_zones_to_load)
@@ -542,6 +901,9 @@ class Linker::Impl
 
             auto absoluteZoneDirectory = absolute(std::filesystem::path(zonePath).remove_filename()).string();
 
+            // Stamped before loading, so a zone file that changes while it is loaded never counts as up to date
+            auto stamp = GetFileStamp(zonePath);
+
             auto zone = std::unique_ptr<Zone>(ZoneLoading::LoadZone(zonePath));
             if (zone == nullptr)
             {
@@ -554,7 +916,7 @@ class Linker::Impl
                 std::cout << "Load zone \"" << zone->m_name << "\"\n";
             }
 
-            m_loaded_zones.emplace_back(std::move(zone));
+            m_loaded_zones.emplace_back(LoadedZone{std::move(zone), zonePath, std::move(stamp)});
         }
 
         return true;
@@ -564,7 +926,7 @@ class Linker::Impl
     {
         for (auto i = m_loaded_zones.rbegin(); i != m_loaded_zones.rend(); ++i)
         {
-            auto& loadedZone = *i;
+            auto& loadedZone = i->m_zone;
             std::string zoneName = loadedZone->m_name;
 
             loadedZone.reset();
@@ -575,6 +937,27 @@ class Linker::Impl
         m_loaded_zones.clear();
     }
 
+    /**
+     * \brief Loads the zones that are kept between the builds of batch mode again when any of their files changed.
+     * All zones are loaded again in their original order, like when the linker started.
+     * \return \c true if the loaded zones are up to date, \c false if loading them again failed.
+     */
+    bool RefreshLoadedZones()
+    {
+        // A previous refresh may have failed to load all zones
+        const auto zonesUpToDate = m_loaded_zones.size() == m_args.m_zones_to_load.size()
+                                   && std::all_of(m_loaded_zones.begin(), m_loaded_zones.end(), [](const LoadedZone& loadedZone)
+                                   {
+                                       return GetFileStamp(loadedZone.m_file_path) == loadedZone.m_stamp;
+                                   });
+
+        if (zonesUpToDate)
+            return true;
+
+        UnloadZones();
+        return LoadZones();
+    }
+
 public:
     Impl()
     = default;
@@ -587,22 +970,35 @@ public:
         if (!m_args.ParseArgs(argc, argv))
             return false;
 
+        if (m_args.m_incremental)
+        {
+            // argv[0] does not need to be a path to the executable, so it is looked up through the OS instead
+            std::string executablePath;
+            m_linker_stamp = FileUtils::GetExecutablePath(executablePath) ? GetFileStamp(executablePath) : ProjectBuildCache::MISSING_FILE_HASH;
+
+            // Without knowing the linker, the build cache cannot tell whether a project was built by a different linker
+            if (m_linker_stamp == ProjectBuildCache::MISSING_FILE_HASH)
+            {
+                std::cout << "Could not determine the linker executable, building without build cache\n";
+                m_args.m_incremental = false;
+            }
+        }
+
         if (!BuildProjectIndependentSearchPaths())
             return false;
 
         if (!LoadZones())
             return false;
 
-        auto result = true;
-        for (const auto& projectName : m_args.m_projects_to_build)
-        {
-            if (!BuildProject(projectName))
-            {
-                result = false;
-                break;
-            }
-        }
+        m_asset_loading_session = std::make_unique<AssetLoadingSession>();
+
+        auto result = BuildProjects(m_args.m_projects_to_build);
+
+        if (m_args.m_batch)
+            result = RunBatch() && result;
 
+        m_asset_loading_session.reset();
+        UnloadKeptProjectSearchPaths();
         UnloadZones();
 
         return result;
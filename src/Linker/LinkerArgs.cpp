@@ -82,6 +82,26 @@ const CommandLineOption* const OPTION_MENU_NO_OPTIMIZATION =
     .WithDescription("Refrain from applying optimizations to parsed menus. (Optimizations increase menu performance and size. May result in less source information when dumped though.)")
     .Build();
 
+const CommandLineOption* const OPTION_JOBS =
+    CommandLineOption::Builder::Create()
+    .WithShortName("j")
+    .WithLongName("jobs")
+    .WithDescription("Specifies the amount of projects that are built at the same time. Defaults to 1.")
+    .WithParameter("jobCount")
+    .Build();
+
+const CommandLineOption* const OPTION_INCREMENTAL =
+    CommandLineOption::Builder::Create()
+    .WithLongName("incremental")
+    .WithDescription("Skips building projects when none of their inputs changed since they were last built with this option.")
+    .Build();
+
+const CommandLineOption* const OPTION_BATCH =
+    CommandLineOption::Builder::Create()
+    .WithLongName("batch")
+    .WithDescription("Keeps running after building the specified projects and builds the projects named on every line read from stdin. Loaded zones and search paths are kept between builds.")
+    .Build();
+
 const CommandLineOption* const COMMAND_LINE_OPTIONS[]
 {
     OPTION_HELP,
@@ -93,7 +113,10 @@ const CommandLineOption* const COMMAND_LINE_OPTIONS[]
     OPTION_SOURCE_SEARCH_PATH,
     OPTION_LOAD,
     OPTION_MENU_PERMISSIVE,
-    OPTION_MENU_NO_OPTIMIZATION
+    OPTION_MENU_NO_OPTIMIZATION,
+    OPTION_JOBS,
+    OPTION_INCREMENTAL,
+    OPTION_BATCH
 };
 
 LinkerArgs::LinkerArgs()
@@ -103,7 +126,10 @@ LinkerArgs::LinkerArgs()
       m_project_pattern(R"(\?project\?)"),
       m_base_folder_depends_on_project(false),
       m_out_folder_depends_on_project(false),
-      m_verbose(false)
+      m_verbose(false),
+      m_job_count(1u),
+      m_incremental(false),
+      m_batch(false)
 {
 }
 
@@ -129,6 +155,22 @@ void LinkerArgs::SetVerbose(const bool isVerbose)
     ObjWriting::Configuration.Verbose = isVerbose;
 }
 
+bool LinkerArgs::SetJobCount()
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_JOBS);
+    char* endPtr;
+    const auto jobCount = strtol(specifiedValue.c_str(), &endPtr, 10);
+
+    if (specifiedValue.empty() || *endPtr != '\0' || jobCount <= 0)
+    {
+        printf("Illegal value: \"%s\" is not a valid job count. Use -? to see usage information.\n", specifiedValue.c_str());
+        return false;
+    }
+
+    m_job_count = static_cast<unsigned>(jobCount);
+    return true;
+}
+
 std::string LinkerArgs::GetBasePathForProject(const std::string& projectName) const
 {
     return std::regex_replace(m_base_folder, m_project_pattern, projectName);
@@ -210,8 +252,11 @@ bool LinkerArgs::ParseArgs(const int argc, const char** argv)
         return false;
     }
 
+    // --batch
+    m_batch = m_argument_parser.IsOptionSpecified(OPTION_BATCH);
+
     m_projects_to_build = m_argument_parser.GetArguments();
-    if (m_projects_to_build.empty())
+    if (m_projects_to_build.empty() && !m_batch)
     {
         // No projects to build specified...
         PrintUsage();
@@ -283,6 +328,16 @@ bool LinkerArgs::ParseArgs(const int argc, const char** argv)
     if (m_argument_parser.IsOptionSpecified(OPTION_MENU_NO_OPTIMIZATION))
         ObjLoading::Configuration.MenuNoOptimization = true;
 
+    // -j; --jobs
+    if (m_argument_parser.IsOptionSpecified(OPTION_JOBS))
+    {
+        if (!SetJobCount())
+            return false;
+    }
+
+    // --incremental
+    m_incremental = m_argument_parser.IsOptionSpecified(OPTION_INCREMENTAL);
+
     return true;
 }
 
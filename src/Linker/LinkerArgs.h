@@ -33,6 +33,7 @@ private:
     static void PrintUsage();
 
     void SetVerbose(bool isVerbose);
+    bool SetJobCount();
 
     _NODISCARD std::string GetBasePathForProject(const std::string& projectName) const;
     void SetDefaultBasePath();
@@ -53,6 +54,9 @@ public:
     std::set<std::string> m_source_search_paths;
 
     bool m_verbose;
+    unsigned m_job_count;
+    bool m_incremental;
+    bool m_batch;
 
     LinkerArgs();
     bool ParseArgs(int argc, const char** argv);
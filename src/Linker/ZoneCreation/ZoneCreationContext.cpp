@@ -2,12 +2,14 @@
 
 ZoneCreationContext::ZoneCreationContext()
     : m_asset_search_path(nullptr),
-      m_definition(nullptr)
+      m_definition(nullptr),
+      m_asset_loading_session(nullptr)
 {
 }
 
 ZoneCreationContext::ZoneCreationContext(ISearchPath* assetSearchPath, ZoneDefinition* definition)
     : m_asset_search_path(assetSearchPath),
-      m_definition(definition)
+      m_definition(definition),
+      m_asset_loading_session(nullptr)
 {
 }
@@ -4,6 +4,7 @@
 #include <memory>
 #include <unordered_map>
 
+#include "AssetLoading/AssetLoadingSession.h"
 #include "SearchPath/ISearchPath.h"
 #include "Obj/Gdt/Gdt.h"
 #include "Zone/AssetList/AssetList.h"
@@ -17,6 +18,7 @@ public:
     ZoneDefinition* m_definition;
     std::vector<std::unique_ptr<Gdt>> m_gdt_files;
     std::vector<AssetListEntry> m_ignored_assets;
+    AssetLoadingSession* m_asset_loading_session;
 
     ZoneCreationContext();
     ZoneCreationContext(ISearchPath* assetSearchPath, ZoneDefinition* definition);
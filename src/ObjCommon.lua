@@ -3,6 +3,7 @@ ObjCommon = {}
 function ObjCommon:include(includes)
 	if includes:handle(self:name()) then
 		Common:include(includes)
+		Crypto:include(includes)
 		minizip:include(includes)
 		includedirs {
 			path.join(ProjectFolder(), "ObjCommon")
@@ -14,6 +15,7 @@ function ObjCommon:link(links)
 	links:add(self:name())
 	links:linkto(Utils)
 	links:linkto(Common)
+	links:linkto(Crypto)
 	links:linkto(minizip)
 end
 
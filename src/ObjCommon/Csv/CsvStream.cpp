@@ -1,55 +1,129 @@
 #include "CsvStream.h"
 
-#include <sstream>
+#include <cstring>
 
 constexpr char CSV_SEPARATOR = ',';
 
 CsvInputStream::CsvInputStream(std::istream& stream)
-    : m_stream(stream)
+    : m_stream(stream),
+      m_buffer(BUFFER_SIZE),
+      m_buffer_pos(0u),
+      m_buffer_end(0u)
 {
 }
 
-bool CsvInputStream::NextRow(std::vector<std::string>& out) const
+bool CsvInputStream::FillBuffer(size_t& rowStart)
 {
-    if (!out.empty())
-        out.clear();
+    if (!m_stream)
+        return false;
+
+    // Keep the part of the current row that was already read at the start of the buffer
+    if (rowStart > 0u)
+    {
+        std::memmove(m_buffer.data(), &m_buffer[rowStart], m_buffer_end - rowStart);
+        m_buffer_pos -= rowStart;
+        m_buffer_end -= rowStart;
+        rowStart = 0u;
+    }
+
+    // Rows that are larger than the buffer make it grow
+    if (m_buffer_end >= m_buffer.size())
+        m_buffer.resize(m_buffer.size() * 2u);
 
-    auto c = m_stream.get();
-    const auto isEof = c == EOF;
-    std::ostringstream col;
-    while(c != EOF)
+    m_stream.read(&m_buffer[m_buffer_end], static_cast<std::streamsize>(m_buffer.size() - m_buffer_end));
+    const auto readCount = static_cast<size_t>(m_stream.gcount());
+    m_buffer_end += readCount;
+
+    return readCount > 0u;
+}
+
+bool CsvInputStream::NextRow(std::vector<std::string_view>& out)
+{
+    enum class CellState
+    {
+        CELL_START,
+        UNQUOTED,
+        QUOTED,
+        AFTER_QUOTED
+    };
+
+    out.clear();
+    m_cell_ends.clear();
+
+    auto rowStart = m_buffer_pos;
+    if (m_buffer_pos >= m_buffer_end && !FillBuffer(rowStart))
+        return false;
+
+    // Cells are written back to the row without separators and quotes, which never takes more space than reading them
+    size_t writeOffset = 0u;
+    auto state = CellState::CELL_START;
+    auto previousChar = '\0';
+    while (m_buffer_pos < m_buffer_end || FillBuffer(rowStart))
     {
-        if(c == CSV_SEPARATOR)
+        const auto c = m_buffer[m_buffer_pos++];
+
+        if (state == CellState::QUOTED)
         {
-            out.emplace_back(col.str());
-            col.clear();
-            col.str(std::string());
+            if (c == '"')
+                state = CellState::AFTER_QUOTED;
+            else
+                m_buffer[rowStart + writeOffset++] = c;
         }
-        else if(c == '\r')
+        else if (c == CSV_SEPARATOR)
         {
-            c = m_stream.get();
-            if (c == '\n')
-                break;
-            col << '\r';
+            m_cell_ends.push_back(writeOffset);
+            state = CellState::CELL_START;
         }
-        else if(c == '\n')
+        else if (c == '\n')
         {
+            // Windows line endings are not part of the last cell
+            if (previousChar == '\r')
+                writeOffset--;
             break;
         }
+        else if (c == '"' && state != CellState::UNQUOTED)
+        {
+            // A quote following a quoted part is an escaped quote
+            if (state == CellState::AFTER_QUOTED)
+                m_buffer[rowStart + writeOffset++] = c;
+            state = CellState::QUOTED;
+        }
         else
         {
-            col << static_cast<char>(c);
+            m_buffer[rowStart + writeOffset++] = c;
+            if (state == CellState::CELL_START)
+                state = CellState::UNQUOTED;
         }
 
-        c = m_stream.get();
+        previousChar = c;
+    }
+    m_cell_ends.push_back(writeOffset);
+
+    const auto* row = &m_buffer[rowStart];
+    size_t cellStart = 0u;
+    for (const auto cellEnd : m_cell_ends)
+    {
+        out.emplace_back(&row[cellStart], cellEnd - cellStart);
+        cellStart = cellEnd;
     }
 
-    if(!isEof)
+    return true;
+}
+
+bool CsvInputStream::NextRow(std::vector<std::string>& out)
+{
+    if (!NextRow(m_cells))
     {
-        out.emplace_back(col.str());
+        out.clear();
+        return false;
     }
 
-    return !isEof;
+    // Reuse the strings of the previous row if there are any
+    out.resize(m_cells.size());
+    for (auto i = 0u; i < m_cells.size(); i++)
+        out[i].assign(m_cells[i]);
+
+    return true;
 }
 
 CsvOutputStream::CsvOutputStream(std::ostream& stream)
@@ -1,16 +1,32 @@
 #pragma once
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 class CsvInputStream
 {
+    static constexpr size_t BUFFER_SIZE = 0x10000;
+
     std::istream& m_stream;
+    std::vector<char> m_buffer;
+    size_t m_buffer_pos;
+    size_t m_buffer_end;
+    std::vector<std::string_view> m_cells;
+    std::vector<size_t> m_cell_ends;
+
+    bool FillBuffer(size_t& rowStart);
 
 public:
     explicit CsvInputStream(std::istream& stream);
 
-    bool NextRow(std::vector<std::string>& out) const;
+    bool NextRow(std::vector<std::string>& out);
+
+    /**
+     * \brief Reads the next row without copying its cells.
+     * Quoted cells are unquoted in place, the returned cells point into the read buffer and are only valid until the next row is read.
+     */
+    bool NextRow(std::vector<std::string_view>& out);
 };
 
 class CsvOutputStream
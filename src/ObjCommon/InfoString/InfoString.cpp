@@ -1,98 +1,247 @@
 #include "InfoString.h"
 
-#include <sstream>
-#include <cstring>
+#include <functional>
 #include <stack>
 
-const std::string InfoString::EMPTY_VALUE;
+std::string_view InfoString::KeyOf(const Entry& entry) const
+{
+    return std::string_view(m_storage).substr(entry.m_key_offset, entry.m_key_length);
+}
+
+std::string_view InfoString::ValueOf(const Entry& entry) const
+{
+    return std::string_view(m_storage).substr(entry.m_value_offset, entry.m_value_length);
+}
+
+size_t InfoString::FindEntry(const std::string_view& key) const
+{
+    if (m_index.empty())
+        return std::string::npos;
+
+    const auto mask = m_index.size() - 1;
+    auto slot = std::hash<std::string_view>()(key) & mask;
+    while (m_index[slot] != 0u)
+    {
+        const auto entryIndex = m_index[slot] - 1;
+        if (KeyOf(m_entries[entryIndex]) == key)
+            return entryIndex;
+
+        slot = (slot + 1) & mask;
+    }
+
+    return std::string::npos;
+}
+
+void InfoString::InsertIntoIndex(const size_t entryIndex)
+{
+    const auto mask = m_index.size() - 1;
+    auto slot = std::hash<std::string_view>()(KeyOf(m_entries[entryIndex])) & mask;
+    while (m_index[slot] != 0u)
+        slot = (slot + 1) & mask;
+
+    m_index[slot] = entryIndex + 1;
+}
+
+void InfoString::RebuildIndex(const size_t capacity)
+{
+    auto indexSize = MIN_INDEX_CAPACITY;
+    while (indexSize < capacity * 2)
+        indexSize <<= 1;
+
+    m_index.assign(indexSize, 0u);
+    for (auto entryIndex = 0u; entryIndex < m_entries.size(); entryIndex++)
+        InsertIntoIndex(entryIndex);
+}
 
-bool InfoString::HasKey(const std::string& key) const
+void InfoString::StoreValue(Entry& entry, const std::string_view& value)
 {
-    return m_values.find(key) != m_values.end();
+    if (value.size() <= entry.m_value_capacity)
+    {
+        // The value fits into the slot of the one it replaces
+        m_storage.replace(entry.m_value_offset, value.size(), value);
+    }
+    else if (entry.m_value_offset + entry.m_value_capacity == m_storage.size())
+    {
+        // The slot is at the end of the storage and can grow
+        m_storage.resize(entry.m_value_offset);
+        m_storage.append(value);
+        entry.m_value_capacity = value.size();
+    }
+    else
+    {
+        m_unused_storage_size += entry.m_value_capacity;
+        entry.m_value_offset = m_storage.size();
+        entry.m_value_capacity = value.size();
+        m_storage.append(value);
+    }
+
+    entry.m_value_length = value.size();
 }
 
-const std::string& InfoString::GetValueForKey(const std::string& key) const
+void InfoString::CompactStorageIfNecessary()
 {
-    const auto& value = m_values.find(key);
+    if (m_unused_storage_size * 2 <= m_storage.size())
+        return;
+
+    std::string storage;
+    storage.reserve(m_storage.size() - m_unused_storage_size);
+
+    for (auto& entry : m_entries)
+    {
+        const auto key = KeyOf(entry);
+        const auto value = ValueOf(entry);
+
+        entry.m_key_offset = storage.size();
+        storage.append(key);
+        entry.m_value_offset = storage.size();
+        entry.m_value_capacity = value.size();
+        storage.append(value);
+    }
 
-    if (value == m_values.end())
-        return EMPTY_VALUE;
+    m_storage = std::move(storage);
+    m_unused_storage_size = 0u;
+}
+
+bool InfoString::HasKey(const std::string_view& key) const
+{
+    return FindEntry(key) != std::string::npos;
+}
 
-    return value->second;
+std::string_view InfoString::GetValueForKey(const std::string_view& key) const
+{
+    return GetValueForKey(key, nullptr);
 }
 
-const std::string& InfoString::GetValueForKey(const std::string& key, bool* foundValue) const
+std::string_view InfoString::GetValueForKey(const std::string_view& key, bool* foundValue) const
 {
-    const auto& value = m_values.find(key);
+    const auto entryIndex = FindEntry(key);
 
-    if (value == m_values.end())
+    if (entryIndex == std::string::npos)
     {
         if (foundValue)
             *foundValue = false;
-        return EMPTY_VALUE;
+        return std::string_view();
     }
 
     if (foundValue)
         *foundValue = true;
-    return value->second;
+    return ValueOf(m_entries[entryIndex]);
+}
+
+void InfoString::SetValueForKey(const std::string_view& key, const std::string_view& value)
+{
+    const auto existingEntryIndex = FindEntry(key);
+    if (existingEntryIndex != std::string::npos)
+    {
+        StoreValue(m_entries[existingEntryIndex], value);
+        CompactStorageIfNecessary();
+        return;
+    }
+
+    Entry entry{};
+    entry.m_key_offset = m_storage.size();
+    entry.m_key_length = key.size();
+    m_storage.append(key);
+    entry.m_value_offset = m_storage.size();
+    StoreValue(entry, value);
+    m_entries.emplace_back(entry);
+
+    if (m_entries.size() * 2 > m_index.size())
+        RebuildIndex(m_entries.size());
+    else
+        InsertIntoIndex(m_entries.size() - 1);
+}
+
+void InfoString::RemoveKey(const std::string_view& key)
+{
+    const auto entryIndex = FindEntry(key);
+
+    if (entryIndex == std::string::npos)
+        return;
+
+    const auto& entry = m_entries[entryIndex];
+    m_unused_storage_size += entry.m_key_length + entry.m_value_capacity;
+
+    m_entries.erase(m_entries.begin() + static_cast<std::ptrdiff_t>(entryIndex));
+    RebuildIndex(m_entries.size());
+    CompactStorageIfNecessary();
+}
+
+void InfoString::Reserve(const size_t keyCount)
+{
+    m_storage.reserve(keyCount * RESERVED_STORAGE_PER_KEY);
+    m_entries.reserve(keyCount);
+
+    if (keyCount * 2 > m_index.size())
+        RebuildIndex(keyCount);
+}
+
+size_t InfoString::GetEntryCount() const
+{
+    return m_entries.size();
 }
 
-void InfoString::SetValueForKey(const std::string& key, std::string value)
+std::string_view InfoString::GetKeyAt(const size_t entryIndex) const
 {
-    if (!HasKey(key))
-        m_keys_by_insertion.push_back(key);
+    return KeyOf(m_entries[entryIndex]);
+}
 
-    m_values[key] = std::move(value);
+std::string_view InfoString::GetValueAt(const size_t entryIndex) const
+{
+    return ValueOf(m_entries[entryIndex]);
 }
 
-void InfoString::RemoveKey(const std::string& key)
+size_t InfoString::CalculateStringLength(const size_t prefixLength) const
 {
-    const auto& value = m_values.find(key);
+    auto length = prefixLength;
+    for (const auto& entry : m_entries)
+        length += entry.m_key_length + entry.m_value_length + 2u;
 
-    if (value != m_values.end())
-        m_values.erase(value);
+    return length;
 }
 
 std::string InfoString::ToString() const
 {
-    std::stringstream ss;
-    bool first = true;
+    std::string result;
+    result.reserve(CalculateStringLength(0u));
 
-    for (const auto& key : m_keys_by_insertion)
+    auto first = true;
+    for (const auto& entry : m_entries)
     {
-        const auto value = m_values.find(key);
         if (!first)
-            ss << '\\';
+            result += '\\';
         else
             first = false;
 
-        ss << key << '\\' << value->second;
+        result.append(KeyOf(entry));
+        result += '\\';
+        result.append(ValueOf(entry));
     }
 
-    return ss.str();
+    return result;
 }
 
 std::string InfoString::ToString(const std::string& prefix) const
 {
-    std::stringstream ss;
-    ss << prefix;
+    std::string result;
+    result.reserve(CalculateStringLength(prefix.size()));
+    result.append(prefix);
 
-    for (const auto& key : m_keys_by_insertion)
+    for (const auto& entry : m_entries)
     {
-        const auto value = m_values.find(key);
-        ss << '\\' << key << '\\' << value->second;
+        result += '\\';
+        result.append(KeyOf(entry));
+        result += '\\';
+        result.append(ValueOf(entry));
     }
 
-    return ss.str();
+    return result;
 }
 
 void InfoString::ToGdtProperties(const std::string& prefix, GdtEntry& gdtEntry) const
 {
-    for (const auto& key : m_keys_by_insertion)
-    {
-        const auto value = m_values.find(key);
-        gdtEntry.m_properties[key] = value->second;
-    }
+    for (const auto& entry : m_entries)
+        gdtEntry.m_properties[std::string(KeyOf(entry))] = std::string(ValueOf(entry));
 
     gdtEntry.m_properties[GDT_PREFIX_FIELD] = prefix;
 }
@@ -111,29 +260,20 @@ public:
 
     bool NextField(std::string& value)
     {
-        std::ostringstream str;
-
-        auto c = m_stream.get();
-        if (c == EOF)
+        if (m_stream.peek() == EOF)
         {
-            if(m_last_separator != EOF)
+            if (m_last_separator != EOF)
             {
                 m_last_separator = EOF;
-                value = std::string();
+                value.clear();
                 return true;
             }
 
             return false;
         }
 
-        while (c != EOF && c != '\\')
-        {
-            str << static_cast<char>(c);
-            c = m_stream.get();
-        }
-
-        m_last_separator = c;
-        value = str.str();
+        std::getline(m_stream, value, '\\');
+        m_last_separator = m_stream.eof() ? EOF : '\\';
         return true;
     }
 };
@@ -143,22 +283,13 @@ bool InfoString::FromStream(std::istream& stream)
     InfoStringInputStream infoStream(stream);
 
     std::string key;
+    std::string value;
     while (infoStream.NextField(key))
     {
-        std::string value;
         if (!infoStream.NextField(value))
             return false;
 
-        const auto existingEntry = m_values.find(key);
-        if (existingEntry == m_values.end())
-        {
-            m_keys_by_insertion.push_back(key);
-            m_values.emplace(std::make_pair(key, value));
-        }
-        else
-        {
-            existingEntry->second = value;
-        }
+        SetValueForKey(key, value);
     }
 
     return true;
@@ -176,22 +307,13 @@ bool InfoString::FromStream(const std::string& prefix, std::istream& stream)
         return false;
 
     std::string key;
+    std::string value;
     while (infoStream.NextField(key))
     {
-        std::string value;
         if (!infoStream.NextField(value))
             return false;
 
-        const auto existingEntry = m_values.find(key);
-        if (existingEntry == m_values.end())
-        {
-            m_keys_by_insertion.push_back(key);
-            m_values.emplace(std::make_pair(key, value));
-        }
-        else
-        {
-            existingEntry->second = value;
-        }
+        SetValueForKey(key, value);
     }
 
     return true;
@@ -216,18 +338,7 @@ bool InfoString::FromGdtProperties(const GdtEntry& gdtEntry)
         entryStack.pop();
 
         for (const auto& [key, value] : currentEntry->m_properties)
-        {
-            auto existingEntry = m_values.find(key);
-            if(existingEntry == m_values.end())
-            {
-                m_keys_by_insertion.push_back(key);
-                m_values.emplace(std::make_pair(key, value));
-            }
-            else
-            {
-                existingEntry->second = value;
-            }
-        }
+            SetValueForKey(key, value);
     }
 
     return true;
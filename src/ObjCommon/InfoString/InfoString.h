@@ -1,7 +1,7 @@
 #pragma once
 #include <istream>
-#include <unordered_map>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "Utils/ClassUtils.h"
@@ -10,17 +10,59 @@
 class InfoString
 {
     static constexpr const char* GDT_PREFIX_FIELD = "configstringFileType";
+    static constexpr size_t MIN_INDEX_CAPACITY = 64u;
 
-    static const std::string EMPTY_VALUE;
-    std::unordered_map<std::string, std::string> m_values;
-    std::vector<std::string> m_keys_by_insertion;
+    // Most keys and values are short, so this amount of storage is reserved for every key that is expected
+    static constexpr size_t RESERVED_STORAGE_PER_KEY = 32u;
+
+    class Entry
+    {
+    public:
+        size_t m_key_offset;
+        size_t m_key_length;
+        size_t m_value_offset;
+        size_t m_value_length;
+        // The size of the storage slot of the value which may be bigger than the value when it was replaced by a shorter one
+        size_t m_value_capacity;
+    };
+
+    // All keys and values are stored in this buffer and referenced by offset from the entries
+    std::string m_storage;
+
+    // Amount of storage that is no longer referenced by any entry. The storage is compacted when this makes up more than half of it.
+    size_t m_unused_storage_size = 0u;
+
+    // Entries in insertion order
+    std::vector<Entry> m_entries;
+
+    // Open addressing hash index with linear probing that maps keys to entries.
+    // A slot holds the entry index plus one, zero marks an empty slot.
+    std::vector<size_t> m_index;
+
+    _NODISCARD std::string_view KeyOf(const Entry& entry) const;
+    _NODISCARD std::string_view ValueOf(const Entry& entry) const;
+    _NODISCARD size_t FindEntry(const std::string_view& key) const;
+    void InsertIntoIndex(size_t entryIndex);
+    void RebuildIndex(size_t capacity);
+    void StoreValue(Entry& entry, const std::string_view& value);
+    void CompactStorageIfNecessary();
+    _NODISCARD size_t CalculateStringLength(size_t prefixLength) const;
 
 public:
-    _NODISCARD bool HasKey(const std::string& key) const;
-    _NODISCARD const std::string& GetValueForKey(const std::string& key) const;
-    const std::string& GetValueForKey(const std::string& key, bool* foundValue) const;
-    void SetValueForKey(const std::string& key, std::string value);
-    void RemoveKey(const std::string& key);
+    _NODISCARD bool HasKey(const std::string_view& key) const;
+    _NODISCARD std::string_view GetValueForKey(const std::string_view& key) const;
+    std::string_view GetValueForKey(const std::string_view& key, bool* foundValue) const;
+    void SetValueForKey(const std::string_view& key, const std::string_view& value);
+    void RemoveKey(const std::string_view& key);
+
+    /**
+     * \brief Reserves space for the specified amount of keys and a typical amount of storage for their values.
+     */
+    void Reserve(size_t keyCount);
+
+    _NODISCARD size_t GetEntryCount() const;
+    _NODISCARD std::string_view GetKeyAt(size_t entryIndex) const;
+    _NODISCARD std::string_view GetValueAt(size_t entryIndex) const;
 
     _NODISCARD std::string ToString() const;
     _NODISCARD std::string ToString(const std::string& prefix) const;
@@ -29,4 +71,4 @@ public:
     bool FromStream(std::istream& stream);
     bool FromStream(const std::string& prefix, std::istream& stream);
     bool FromGdtProperties(const GdtEntry& gdtEntry);
-};
\ No newline at end of file
+};
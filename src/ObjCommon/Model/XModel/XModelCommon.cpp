@@ -53,13 +53,16 @@ bool operator==(const VertexMergerPos& lhs, const VertexMergerPos& rhs)
         && std::fabs(lhs.y - rhs.y) < std::numeric_limits<float>::epsilon()
         && std::fabs(lhs.z - rhs.z) < std::numeric_limits<float>::epsilon();
 
-    if (!coordinatesMatch || lhs.weightCount != rhs.weightCount)
+    if (!coordinatesMatch || lhs.boneWeights.weightCount != rhs.boneWeights.weightCount)
         return false;
 
-    for (auto weightIndex = 0u; weightIndex < lhs.weightCount; weightIndex++)
+    for (auto weightIndex = 0u; weightIndex < lhs.boneWeights.weightCount; weightIndex++)
     {
-        if (lhs.weights[weightIndex].boneIndex != rhs.weights[weightIndex].boneIndex
-            || std::fabs(lhs.weights[weightIndex].weight - rhs.weights[weightIndex].weight) >= std::numeric_limits<float>::epsilon())
+        const auto& lhsWeight = lhs.boneWeights.weights[weightIndex];
+        const auto& rhsWeight = rhs.boneWeights.weights[weightIndex];
+
+        if (lhsWeight.boneIndex != rhsWeight.boneIndex
+            || std::fabs(lhsWeight.weight - rhsWeight.weight) >= std::numeric_limits<float>::epsilon())
         {
             return false;
         }
@@ -68,25 +71,25 @@ bool operator==(const VertexMergerPos& lhs, const VertexMergerPos& rhs)
     return true;
 }
 
-bool operator!=(const VertexMergerPos& lhs, VertexMergerPos& rhs)
+bool operator!=(const VertexMergerPos& lhs, const VertexMergerPos& rhs)
 {
     return !(lhs == rhs);
 }
 
 bool operator<(const VertexMergerPos& lhs, const VertexMergerPos& rhs)
 {
-    const auto t0 = std::tie(lhs.x, lhs.y, lhs.z, rhs.weightCount);
-    const auto t1 = std::tie(rhs.x, rhs.y, rhs.z, rhs.weightCount);
+    const auto t0 = std::tie(lhs.x, lhs.y, lhs.z, lhs.boneWeights.weightCount);
+    const auto t1 = std::tie(rhs.x, rhs.y, rhs.z, rhs.boneWeights.weightCount);
     if (t0 < t1)
         return true;
 
     if (!(t0 == t1))
         return false;
 
-    for (auto weightIndex = 0u; weightIndex < lhs.weightCount; weightIndex++)
+    for (auto weightIndex = 0u; weightIndex < lhs.boneWeights.weightCount; weightIndex++)
     {
-        const auto& lhsWeight = lhs.weights[weightIndex];
-        const auto& rhsWeight = rhs.weights[weightIndex];
+        const auto& lhsWeight = lhs.boneWeights.weights[weightIndex];
+        const auto& rhsWeight = rhs.boneWeights.weights[weightIndex];
 
         const auto t2 = std::tie(lhsWeight.boneIndex, lhsWeight.weight);
         const auto t3 = std::tie(rhsWeight.boneIndex, rhsWeight.weight);
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <string>
-#include <memory>
 
 #include "Utils/DistinctMapper.h"
 #include "Math/Quaternion.h"
@@ -28,15 +27,11 @@ struct XModelBoneWeight
     float weight;
 };
 
-struct XModelVertexBoneWeightCollection
-{
-    std::unique_ptr<XModelBoneWeight[]> weights;
-    size_t totalWeightCount;
-};
-
 struct XModelVertexBoneWeights
 {
-    const XModelBoneWeight* weights;
+    static constexpr size_t MAX_WEIGHT_COUNT = 4u;
+
+    XModelBoneWeight weights[MAX_WEIGHT_COUNT];
     size_t weightCount;
 };
 
@@ -92,8 +87,7 @@ struct VertexMergerPos
     float x;
     float y;
     float z;
-    const XModelBoneWeight* weights;
-    size_t weightCount;
+    XModelVertexBoneWeights boneWeights;
 
     friend bool operator==(const VertexMergerPos& lhs, const VertexMergerPos& rhs);
     friend bool operator!=(const VertexMergerPos& lhs, const VertexMergerPos& rhs);
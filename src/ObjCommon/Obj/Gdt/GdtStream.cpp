@@ -1,7 +1,6 @@
 #include "GdtStream.h"
 
 #include <iostream>
-#include <sstream>
 
 class GdtConst
 {
@@ -17,6 +16,26 @@ void GdtReader::PrintError(const std::string& message) const
     std::cout << "GDT Error at line " << m_line << ": " << message << "\n";
 }
 
+bool GdtReader::FillBuffer()
+{
+    if (!m_stream)
+        return false;
+
+    m_stream.read(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+    m_buffer_pos = 0u;
+    m_buffer_end = static_cast<size_t>(m_stream.gcount());
+
+    return m_buffer_end > 0u;
+}
+
+int GdtReader::GetChar()
+{
+    if (m_buffer_pos >= m_buffer_end && !FillBuffer())
+        return EOF;
+
+    return static_cast<unsigned char>(m_buffer[m_buffer_pos++]);
+}
+
 int GdtReader::PeekChar()
 {
     if (m_peeked)
@@ -25,7 +44,7 @@ int GdtReader::PeekChar()
     int c;
     do
     {
-        c = m_stream.get();
+        c = GetChar();
     }
     while (isspace(c));
 
@@ -45,7 +64,7 @@ int GdtReader::NextChar()
     int c;
     do
     {
-        c = m_stream.get();
+        c = GetChar();
     }
     while (isspace(c));
 
@@ -54,64 +73,67 @@ int GdtReader::NextChar()
 
 bool GdtReader::ReadStringContent(std::string& str)
 {
-    std::ostringstream ss;
-
     if (NextChar() != '"')
     {
         PrintError("Expected string opening tag");
         return false;
     }
 
-    auto c = m_stream.get();
+    str.clear();
     auto escaped = false;
-    while ((escaped || c != '"' && c != '\n') && c != EOF)
+    while (true)
     {
+        if (m_buffer_pos >= m_buffer_end && !FillBuffer())
+            return false;
+
+        if (!escaped)
+        {
+            // Take over all characters up to the next one that needs special handling at once
+            const auto* start = &m_buffer[m_buffer_pos];
+            const auto* end = &m_buffer[m_buffer_end];
+            const auto* current = start;
+            while (current < end && *current != '"' && *current != '\\' && *current != '\n')
+                ++current;
+
+            str.append(start, current);
+            m_buffer_pos += static_cast<size_t>(current - start);
+
+            if (current == end)
+                continue;
+        }
+
+        const auto c = m_buffer[m_buffer_pos++];
         if (escaped)
         {
             switch (c)
             {
             case '\n':
             case 'n':
-                ss << '\n';
+                str.push_back('\n');
                 break;
 
             case 'r':
-                ss << '\r';
+                str.push_back('\r');
                 break;
 
             default:
-                ss << static_cast<char>(c);
+                str.push_back(c);
                 break;
             }
             escaped = false;
         }
-        else if(c == '\\')
-        {
+        else if (c == '\\')
             escaped = true;
-        }
         else
-        {
-            ss << static_cast<char>(c);
-        }
-        c = m_stream.get();
-    }
-
-    if (c == '"')
-    {
-        str = ss.str();
-        return true;
+            return c == '"';
     }
-
-    return false;
 }
 
-GdtEntry* GdtReader::GetEntryByName(const Gdt& gdt, const std::string& name)
+GdtEntry* GdtReader::GetEntryByName(const std::string& name) const
 {
-    for (const auto& entry : gdt.m_entries)
-    {
-        if (entry->m_name == name)
-            return entry.get();
-    }
+    const auto foundEntry = m_entries_by_name.find(name);
+    if (foundEntry != m_entries_by_name.end())
+        return foundEntry->second;
 
     return nullptr;
 }
@@ -145,7 +167,7 @@ bool GdtReader::ReadProperties(GdtEntry& entry)
     return true;
 }
 
-bool GdtReader::AddEntry(Gdt& gdt, GdtEntry& entry) const
+bool GdtReader::AddEntry(Gdt& gdt, GdtEntry& entry)
 {
     if (entry.m_name == GdtConst::VERSION_ENTRY_NAME
         && entry.m_gdf_name == GdtConst::VERSION_ENTRY_GDF)
@@ -168,7 +190,10 @@ bool GdtReader::AddEntry(Gdt& gdt, GdtEntry& entry) const
     }
     else
     {
-        gdt.m_entries.emplace_back(std::make_unique<GdtEntry>(std::move(entry)));
+        auto* addedEntry = gdt.m_entries.emplace_back(std::make_unique<GdtEntry>(std::move(entry))).get();
+
+        // Parents are looked up by name, the first entry with a name is the one that is used
+        m_entries_by_name.emplace(addedEntry->m_name, addedEntry);
     }
 
     return true;
@@ -176,6 +201,9 @@ bool GdtReader::AddEntry(Gdt& gdt, GdtEntry& entry) const
 
 GdtReader::GdtReader(std::istream& stream)
     : m_stream(stream),
+      m_buffer(BUFFER_SIZE),
+      m_buffer_pos(0u),
+      m_buffer_end(0u),
       m_char(0),
       m_peeked(false),
       m_line(0)
@@ -184,6 +212,9 @@ GdtReader::GdtReader(std::istream& stream)
 
 bool GdtReader::Read(Gdt& gdt)
 {
+    for (const auto& existingEntry : gdt.m_entries)
+        m_entries_by_name.emplace(existingEntry->m_name, existingEntry.get());
+
     if (NextChar() != '{')
     {
         PrintError("Expected opening tag");
@@ -228,7 +259,7 @@ bool GdtReader::Read(Gdt& gdt)
                 PrintError("Expected closing square brackets");
                 return false;
             }
-            entry.m_parent = GetEntryByName(gdt, parentName);
+            entry.m_parent = GetEntryByName(parentName);
             if (entry.m_parent == nullptr)
             {
                 PrintError("Could not find parent with name");
@@ -1,22 +1,33 @@
 #pragma once
 #include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "Gdt.h"
 
 class GdtReader
 {
+    static constexpr size_t BUFFER_SIZE = 0x10000;
+
     std::istream& m_stream;
+    std::vector<char> m_buffer;
+    size_t m_buffer_pos;
+    size_t m_buffer_end;
     char m_char;
     bool m_peeked;
     int m_line;
+    std::unordered_map<std::string, GdtEntry*> m_entries_by_name;
 
-    static GdtEntry* GetEntryByName(const Gdt& gdt, const std::string& name);
+    GdtEntry* GetEntryByName(const std::string& name) const;
     void PrintError(const std::string& message) const;
+    bool FillBuffer();
+    int GetChar();
     int PeekChar();
     int NextChar();
     bool ReadStringContent(std::string& str);
     bool ReadProperties(GdtEntry& entry);
-    bool AddEntry(Gdt& gdt, GdtEntry& entry) const;
+    bool AddEntry(Gdt& gdt, GdtEntry& entry);
 
 public:
     explicit GdtReader(std::istream& stream);
@@ -3,6 +3,7 @@
 #include <cassert>
 #include <cstring>
 
+#include "Crypto.h"
 #include "Utils/FileUtils.h"
 
 using namespace d3d9;
@@ -245,3 +246,32 @@ std::unique_ptr<ShaderInfo> ShaderAnalyser::GetShaderInfo(const uint32_t* shader
 
     return shaderInfo;
 }
+
+const ShaderInfo* ShaderInfoCache::GetShaderInfo(const uint32_t* shaderByteCode, const size_t shaderByteCodeSize)
+{
+    if (shaderByteCode == nullptr || shaderByteCodeSize == 0)
+        return nullptr;
+
+    const auto hashFunction = Crypto::CreateSHA1();
+    std::string shaderHash(hashFunction->GetHashSize(), '\0');
+    hashFunction->Init();
+    hashFunction->Process(shaderByteCode, shaderByteCodeSize);
+    hashFunction->Finish(shaderHash.data());
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto foundShaderInfo = m_shader_infos.find(shaderHash);
+        if (foundShaderInfo != m_shader_infos.end())
+            return foundShaderInfo->second.get();
+    }
+
+    // Shaders are analysed without holding the lock, so other threads can keep using the cache in the meantime
+    auto shaderInfo = ShaderAnalyser::GetShaderInfo(shaderByteCode, shaderByteCodeSize);
+
+    // Shaders that cannot be analysed are remembered as well
+    // When another thread analysed the same shader in the meantime its info is kept instead
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto shaderInfoEntry = m_shader_infos.emplace(std::move(shaderHash), std::move(shaderInfo)).first;
+
+    return shaderInfoEntry->second.get();
+}
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace d3d9
@@ -97,4 +99,24 @@ namespace d3d9
     public:
         static std::unique_ptr<ShaderInfo> GetShaderInfo(const uint32_t* shaderByteCode, size_t shaderByteCodeSize);
     };
+
+    /**
+     * \brief Remembers the info of analysed shaders, so shader byte code with the same content is only analysed once.
+     * Shaders are identified by a hash of their byte code, so the byte code itself is not kept.
+     * The infos stay valid as long as the cache exists.
+     * Can be used by multiple threads at the same time.
+     */
+    class ShaderInfoCache
+    {
+    public:
+        /**
+         * \brief Returns the info of a shader that is only analysed the first time shader byte code with the same content is passed.
+         * \return The info of the shader or \c nullptr if the shader byte code could not be analysed.
+         */
+        const ShaderInfo* GetShaderInfo(const uint32_t* shaderByteCode, size_t shaderByteCodeSize);
+
+    private:
+        std::mutex m_mutex;
+        std::unordered_map<std::string, std::unique_ptr<ShaderInfo>> m_shader_infos;
+    };
 }
\ No newline at end of file
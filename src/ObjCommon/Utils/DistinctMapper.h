@@ -22,6 +22,13 @@ public:
         m_distinct_position_by_input_position.reserve(totalInputCount);
     }
 
+    void Reserve(const size_t totalInputCount)
+    {
+        m_distinct_position_by_input_position.reserve(totalInputCount);
+        m_input_position_by_distinct_position.reserve(totalInputCount);
+        m_distinct_values.reserve(totalInputCount);
+    }
+
     bool Add(T inputValue)
     {
         const auto mapEntry = m_distinct_position_by_value_map.find(inputValue);
@@ -1,49 +1,66 @@
 #include "AssetLoadingContext.h"
 
-AssetLoadingContext::AssetLoadingContext(Zone* zone, ISearchPath* rawSearchPath, std::vector<Gdt*> gdtFiles)
-    : m_zone(zone),
+AssetLoadingContext::AssetLoadingContext(Zone* zone, ISearchPath* rawSearchPath, std::vector<Gdt*> gdtFiles, AssetLoadingSession* session)
+    : m_gdt_entries_grouped(false),
+      m_own_session(session ? nullptr : std::make_unique<AssetLoadingSession>()),
+      m_zone(zone),
       m_raw_search_path(rawSearchPath),
-      m_gdt_files(std::move(gdtFiles))
+      m_gdt_files(std::move(gdtFiles)),
+      m_session(session ? session : m_own_session.get())
 {
-    BuildGdtEntryCache();
 }
 
-void AssetLoadingContext::BuildGdtEntryCache()
+void AssetLoadingContext::GroupGdtEntriesByGdf()
 {
+    m_gdt_entries_grouped = true;
+
+    // Entries of the same gdf usually follow each other so the gdf only needs to be looked up when it changes
+    GdfEntries* currentGdfEntries = nullptr;
+    const std::string* currentGdfName = nullptr;
     for (auto* gdt : m_gdt_files)
     {
         for (const auto& entry : gdt->m_entries)
         {
-            auto gdfMapEntry = m_entries_by_gdf_and_by_name.find(entry->m_gdf_name);
-            if (gdfMapEntry == m_entries_by_gdf_and_by_name.end())
+            if (currentGdfName == nullptr || *currentGdfName != entry->m_gdf_name)
             {
-                std::unordered_map<std::string, GdtEntry*> entryMap;
-                entryMap.emplace(std::make_pair(entry->m_name, entry.get()));
-                m_entries_by_gdf_and_by_name.emplace(std::make_pair(entry->m_gdf_name, std::move(entryMap)));
+                currentGdfEntries = &m_entries_by_gdf[entry->m_gdf_name];
+                currentGdfName = &entry->m_gdf_name;
             }
-            else
-            {
-                auto entryMapEntry = gdfMapEntry->second.find(entry->m_name);
 
-                if (entryMapEntry == gdfMapEntry->second.end())
-                    gdfMapEntry->second.emplace(std::make_pair(entry->m_name, entry.get()));
-                else
-                    entryMapEntry->second = entry.get();
-            }
+            currentGdfEntries->m_entries.push_back(entry.get());
         }
     }
 }
 
+void AssetLoadingContext::IndexGdfEntries(GdfEntries& gdfEntries)
+{
+    gdfEntries.m_entries_by_name.reserve(gdfEntries.m_entries.size());
+
+    // Later entries replace earlier entries with the same name
+    for (auto* entry : gdfEntries.m_entries)
+        gdfEntries.m_entries_by_name[entry->m_name] = entry;
+
+    gdfEntries.m_entries = std::vector<GdtEntry*>();
+    gdfEntries.m_indexed = true;
+}
+
 GdtEntry* AssetLoadingContext::GetGdtEntryByGdfAndName(const std::string& gdfName, const std::string& entryName)
 {
-    const auto foundGdtMap = m_entries_by_gdf_and_by_name.find(gdfName);
+    if (!m_gdt_entries_grouped)
+        GroupGdtEntriesByGdf();
 
-    if (foundGdtMap == m_entries_by_gdf_and_by_name.end())
+    const auto foundGdf = m_entries_by_gdf.find(gdfName);
+
+    if (foundGdf == m_entries_by_gdf.end())
         return nullptr;
 
-    const auto foundGdtEntry = foundGdtMap->second.find(entryName);
+    auto& gdfEntries = foundGdf->second;
+    if (!gdfEntries.m_indexed)
+        IndexGdfEntries(gdfEntries);
+
+    const auto foundGdtEntry = gdfEntries.m_entries_by_name.find(entryName);
 
-    if (foundGdtEntry == foundGdtMap->second.end())
+    if (foundGdtEntry == gdfEntries.m_entries_by_name.end())
         return nullptr;
 
     return foundGdtEntry->second;
@@ -4,6 +4,7 @@
 #include <typeindex>
 #include <type_traits>
 
+#include "AssetLoadingSession.h"
 #include "IGdtQueryable.h"
 #include "IZoneAssetLoaderState.h"
 #include "Obj/Gdt/Gdt.h"
@@ -12,18 +13,36 @@
 
 class AssetLoadingContext final : public IGdtQueryable
 {
-    std::unordered_map<std::string, std::unordered_map<std::string, GdtEntry*>> m_entries_by_gdf_and_by_name;
+    class GdfEntries
+    {
+    public:
+        // Entries of the gdf in the order of the gdt files. Moved into the map by name when the gdf is queried for the first time.
+        std::vector<GdtEntry*> m_entries;
+        bool m_indexed = false;
+        std::unordered_map<std::string, GdtEntry*> m_entries_by_name;
+    };
+
+    bool m_gdt_entries_grouped;
+    std::unordered_map<std::string, GdfEntries> m_entries_by_gdf;
     std::unordered_map<std::type_index, std::unique_ptr<IZoneAssetLoaderState>> m_zone_asset_loader_states;
 
-    void BuildGdtEntryCache();
+    // Only set when the context was not created for a session, so state of the session is not kept longer than the zone
+    std::unique_ptr<AssetLoadingSession> m_own_session;
+
+    /**
+     * \brief Sorts all gdt entries by their gdf. Entries are only indexed by name once their gdf is queried, since zones usually only use a few entries of few gdfs.
+     */
+    void GroupGdtEntriesByGdf();
+    static void IndexGdfEntries(GdfEntries& gdfEntries);
 
 public:
     Zone* const m_zone;
     ISearchPath* const m_raw_search_path;
     const std::vector<Gdt*> m_gdt_files;
     std::unordered_map<std::string, asset_type_t> m_ignored_asset_map;
+    AssetLoadingSession* const m_session;
 
-    AssetLoadingContext(Zone* zone, ISearchPath* rawSearchPath, std::vector<Gdt*> gdtFiles);
+    AssetLoadingContext(Zone* zone, ISearchPath* rawSearchPath, std::vector<Gdt*> gdtFiles, AssetLoadingSession* session = nullptr);
     GdtEntry* GetGdtEntryByGdfAndName(const std::string& gdfName, const std::string& entryName) override;
 
     template<typename T>
@@ -42,4 +61,13 @@ public:
         m_zone_asset_loader_states.emplace(std::make_pair<std::type_index, std::unique_ptr<IZoneAssetLoaderState>>(typeid(T), std::move(newState)));
         return newStatePtr;
     }
+
+    /**
+     * \brief Gets state that is shared with all other zones of the session the zone is created in.
+     */
+    template<typename T>
+    T* GetSessionAssetLoaderState()
+    {
+        return m_session->GetSessionAssetLoaderState<T>();
+    }
 };
@@ -113,6 +113,11 @@ XAssetInfoGeneric* AssetLoadingManager::LoadAssetDependency(const asset_type_t a
 
 XAssetInfoGeneric* AssetLoadingManager::LoadDependency(const asset_type_t assetType, const std::string& assetName)
 {
+    auto& resolvedDependenciesOfType = m_resolved_dependencies[assetType];
+    const auto resolvedDependency = resolvedDependenciesOfType.find(assetName);
+    if (resolvedDependency != resolvedDependenciesOfType.end())
+        return resolvedDependency->second;
+
     auto* alreadyLoadedAsset = m_context.m_zone->m_pools->GetAsset(assetType, assetName);
     if (alreadyLoadedAsset)
         return alreadyLoadedAsset;
@@ -120,15 +125,22 @@ XAssetInfoGeneric* AssetLoadingManager::LoadDependency(const asset_type_t assetT
     const auto loader = m_asset_loaders_by_type.find(assetType);
     if (loader != m_asset_loaders_by_type.end())
     {
+        XAssetInfoGeneric* loadedAsset;
+
         const auto ignoreEntry = m_context.m_ignored_asset_map.find(assetName);
         if (ignoreEntry != m_context.m_ignored_asset_map.end() && ignoreEntry->second == assetType)
         {
             const auto linkAssetName = ',' + assetName;
 
-            return LoadIgnoredDependency(assetType, linkAssetName, loader->second.get());
+            loadedAsset = LoadIgnoredDependency(assetType, linkAssetName, loader->second.get());
         }
+        else
+            loadedAsset = LoadAssetDependency(assetType, assetName, loader->second.get());
+
+        if (loadedAsset)
+            resolvedDependenciesOfType.emplace(assetName, loadedAsset);
 
-        return LoadAssetDependency(assetType, assetName, loader->second.get());
+        return loadedAsset;
     }
 
     std::cout << "Failed to find loader for asset type \"" << m_context.m_zone->m_pools->GetAssetTypeName(assetType) << "\"" << std::endl;
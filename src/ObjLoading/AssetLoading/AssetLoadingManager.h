@@ -1,5 +1,6 @@
 #pragma once
 #include <map>
+#include <unordered_map>
 
 #include "AssetLoadingContext.h"
 #include "IAssetLoader.h"
@@ -11,6 +12,10 @@ class AssetLoadingManager final : public IAssetLoadingManager
     AssetLoadingContext& m_context;
     XAssetInfoGeneric* m_last_dependency_loaded;
 
+    // The asset each dependency resolved to by type and requested name.
+    // Assets from other zones can be added with a different name than they were requested with, so the pool of the zone alone does not find them again.
+    std::unordered_map<asset_type_t, std::unordered_map<std::string, XAssetInfoGeneric*>> m_resolved_dependencies;
+
     XAssetInfoGeneric* LoadIgnoredDependency(asset_type_t assetType, const std::string& assetName, IAssetLoader* loader);
     XAssetInfoGeneric* LoadAssetDependency(asset_type_t assetType, const std::string& assetName, IAssetLoader* loader);
 
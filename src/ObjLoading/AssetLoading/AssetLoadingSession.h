@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <type_traits>
+#include <unordered_map>
+
+#include "ISessionAssetLoaderState.h"
+
+/**
+ * \brief Keeps state of asset loaders that is shared by all zones that are created during a session, e.g. files that were already parsed.
+ * Everything that is kept is freed when the session is destroyed.
+ * Can be used by multiple threads at the same time, which means the states themselves must be as well.
+ */
+class AssetLoadingSession
+{
+    std::mutex m_session_asset_loader_states_mutex;
+    std::unordered_map<std::type_index, std::unique_ptr<ISessionAssetLoaderState>> m_session_asset_loader_states;
+
+public:
+    template<typename T>
+    T* GetSessionAssetLoaderState()
+    {
+        static_assert(std::is_base_of_v<ISessionAssetLoaderState, T>, "T must inherit ISessionAssetLoaderState");
+        // T must also have a public default constructor
+
+        std::lock_guard<std::mutex> lock(m_session_asset_loader_states_mutex);
+
+        const auto foundEntry = m_session_asset_loader_states.find(typeid(T));
+        if (foundEntry != m_session_asset_loader_states.end())
+            return dynamic_cast<T*>(foundEntry->second.get());
+
+        auto newState = std::make_unique<T>();
+        auto* newStatePtr = newState.get();
+        m_session_asset_loader_states.emplace(std::make_pair<std::type_index, std::unique_ptr<ISessionAssetLoaderState>>(typeid(T), std::move(newState)));
+        return newStatePtr;
+    }
+};
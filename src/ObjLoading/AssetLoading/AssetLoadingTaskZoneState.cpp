@@ -0,0 +1,32 @@
+#include "AssetLoadingTaskZoneState.h"
+
+#include "ObjLoading.h"
+
+void AssetLoadingTaskZoneState::Enqueue(const size_t dataSize, std::function<bool()> task)
+{
+    // Only start threads for zones that actually have work to do
+    if (!m_task_pool)
+    {
+        const auto threadCount = ObjLoading::Configuration.AssetLoadingThreadCount > 0
+                                     ? ObjLoading::Configuration.AssetLoadingThreadCount
+                                     : TaskPool::DefaultThreadCount();
+
+        m_task_pool = std::make_unique<TaskPool>(threadCount, ObjLoading::Configuration.AssetLoadingTaskDataBudget);
+    }
+
+    m_task_pool->Enqueue(
+        [this, task = std::move(task)]
+        {
+            if (!task())
+                m_task_failed = true;
+        },
+        dataSize);
+}
+
+bool AssetLoadingTaskZoneState::WaitForTasks()
+{
+    if (m_task_pool)
+        m_task_pool->WaitForCompletion();
+
+    return !m_task_failed;
+}
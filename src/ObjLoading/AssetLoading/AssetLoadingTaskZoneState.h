@@ -0,0 +1,35 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+#include "IZoneAssetLoaderState.h"
+#include "Utils/ClassUtils.h"
+#include "Utils/TaskPool.h"
+
+/**
+ * \brief Runs work of loaded assets concurrently to loading the remaining assets of a zone.
+ * Tasks must only touch data of the asset they were enqueued for and must not use the memory manager of the zone.
+ * Assets are still added to the zone in the order they are loaded, so the created zone does not depend on the order tasks finish in.
+ * The amount of data that is processed at once is limited by the configured budget to keep the memory usage in check.
+ */
+class AssetLoadingTaskZoneState final : public IZoneAssetLoaderState
+{
+    std::atomic_bool m_task_failed{false};
+    std::unique_ptr<TaskPool> m_task_pool;
+
+public:
+    /**
+     * \brief Enqueues work for a loaded asset.
+     * \param dataSize The amount of data the task processes.
+     * \param task The task to run. Returns \c false when the asset could not be loaded, which fails the zone when waiting for the tasks.
+     */
+    void Enqueue(size_t dataSize, std::function<bool()> task);
+
+    /**
+     * \brief Waits for all enqueued tasks. Must be called before the zone is finalized.
+     * \return \c true if all tasks succeeded, \c false if any of them failed.
+     */
+    _NODISCARD bool WaitForTasks();
+};
@@ -46,8 +46,9 @@ public:
         return false;
     }
 
-    virtual void FinalizeAssetsForZone(AssetLoadingContext* context) const
+    virtual bool FinalizeAssetsForZone(AssetLoadingContext* context) const
     {
         // Do nothing by default
+        return true;
     }
 };
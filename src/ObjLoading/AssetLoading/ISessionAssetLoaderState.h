@@ -0,0 +1,14 @@
+#pragma once
+
+class ISessionAssetLoaderState
+{
+protected:
+    ISessionAssetLoaderState() = default;
+
+public:
+    virtual ~ISessionAssetLoaderState() = default;
+    ISessionAssetLoaderState(const ISessionAssetLoaderState& other) = default;
+    ISessionAssetLoaderState(ISessionAssetLoaderState&& other) noexcept = default;
+    ISessionAssetLoaderState& operator=(const ISessionAssetLoaderState& other) = default;
+    ISessionAssetLoaderState& operator=(ISessionAssetLoaderState&& other) noexcept = default;
+};
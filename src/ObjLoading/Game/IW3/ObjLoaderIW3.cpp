@@ -179,8 +179,15 @@ bool ObjLoader::LoadAssetForZone(AssetLoadingContext* context, const asset_type_
     return assetLoadingManager.LoadAssetFromLoader(assetType, assetName);
 }
 
-void ObjLoader::FinalizeAssetsForZone(AssetLoadingContext* context) const
+bool ObjLoader::FinalizeAssetsForZone(AssetLoadingContext* context) const
 {
+    // All loaders have to be finalized even when one of them failed
+    auto result = true;
     for (const auto& [type, loader] : m_asset_loaders_by_type)
-        loader->FinalizeAssetsForZone(context);
+    {
+        if (!loader->FinalizeAssetsForZone(context))
+            result = false;
+    }
+
+    return result;
 }
\ No newline at end of file
@@ -812,8 +812,9 @@ namespace IW4
             auto* loadingContext = m_manager->GetAssetLoadingContext();
             auto* searchPath = loadingContext->m_raw_search_path;
             auto* definitionCache = loadingContext->GetZoneAssetLoaderState<techset::TechsetDefinitionCache>();
+            auto* fileCache = loadingContext->GetSessionAssetLoaderState<techset::TechsetDefinitionFileCache>();
 
-            const auto* techsetDefinition = AssetLoaderTechniqueSet::LoadTechsetDefinition(techsetName, searchPath, definitionCache);
+            const auto* techsetDefinition = AssetLoaderTechniqueSet::LoadTechsetDefinition(techsetName, searchPath, definitionCache, fileCache);
             if (techsetDefinition == nullptr)
             {
                 std::ostringstream ss;
@@ -892,7 +893,8 @@ namespace IW4
             }
 
             const auto stateMapName = extractor.RetrieveStateMap();
-            const auto* loadedStateMap = AssetLoaderTechniqueSet::LoadStateMapDefinition(stateMapName, m_search_path, m_state_map_cache);
+            auto* fileCache = m_manager->GetAssetLoadingContext()->GetSessionAssetLoaderState<techset::StateMapDefinitionFileCache>();
+            const auto* loadedStateMap = AssetLoaderTechniqueSet::LoadStateMapDefinition(stateMapName, m_search_path, m_state_map_cache, fileCache);
             m_state_map_cache->SetTechniqueUsesStateMap(techniqueName, loadedStateMap);
 
             return loadedStateMap;
@@ -900,7 +902,7 @@ namespace IW4
 
         GfxStateBits CalculateStateBitsWithStateMap(const state_map::StateMapDefinition* stateMap) const
         {
-            const state_map::StateMapHandler stateMapHandler(stateMapLayout, *stateMap);
+            const auto& stateMapHandler = m_state_map_cache->GetStateMapHandler(stateMapLayout, *stateMap);
 
             GfxStateBits outBits{};
             stateMapHandler.ApplyStateMap(m_base_state_bits.loadBits, outBits.loadBits);
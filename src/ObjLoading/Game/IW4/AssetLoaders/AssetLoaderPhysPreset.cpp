@@ -18,7 +18,7 @@ namespace IW4
     class InfoStringToPhysPresetConverter final : public InfoStringToStructConverter
     {
     protected:
-        bool ConvertExtensionField(const cspField_t& field, const std::string& value) override
+        bool ConvertExtensionField(const cspField_t& field, const std::string_view& value) override
         {
             assert(false);
             return false;
@@ -82,16 +82,23 @@ namespace IW4
         }
     };
 
+    // Shaders of all zones of the session are only analysed once
+    class ShaderAnalysisSessionState final : public ISessionAssetLoaderState
+    {
+    public:
+        d3d9::ShaderInfoCache m_shader_info_cache;
+    };
+
     class ShaderInfoFromFileSystemCacheState final : public IZoneAssetLoaderState
     {
-        std::unordered_map<std::string, std::unique_ptr<d3d9::ShaderInfo>> m_cached_shader_info;
+        std::unordered_map<std::string, const d3d9::ShaderInfo*> m_cached_shader_info;
 
     public:
-        _NODISCARD const d3d9::ShaderInfo* LoadShaderInfoFromDisk(ISearchPath* searchPath, const std::string& fileName)
+        _NODISCARD const d3d9::ShaderInfo* LoadShaderInfoFromDisk(ISearchPath* searchPath, const std::string& fileName, d3d9::ShaderInfoCache& shaderInfoCache)
         {
             const auto cachedShaderInfo = m_cached_shader_info.find(fileName);
             if (cachedShaderInfo != m_cached_shader_info.end())
-                return cachedShaderInfo->second.get();
+                return cachedShaderInfo->second;
 
             const auto file = searchPath->Open(fileName);
             if (!file.IsOpen())
@@ -108,13 +115,12 @@ namespace IW4
             const auto shaderData = std::make_unique<char[]>(shaderSize);
             file.m_stream->read(shaderData.get(), shaderSize);
 
-            auto shaderInfo = d3d9::ShaderAnalyser::GetShaderInfo(reinterpret_cast<const uint32_t*>(shaderData.get()), shaderSize);
+            const auto* shaderInfo = shaderInfoCache.GetShaderInfo(reinterpret_cast<const uint32_t*>(shaderData.get()), shaderSize);
             if (!shaderInfo)
                 return nullptr;
 
-            const auto* result = shaderInfo.get();
-            m_cached_shader_info.emplace(std::make_pair(fileName, std::move(shaderInfo)));
-            return result;
+            m_cached_shader_info.emplace(std::make_pair(fileName, shaderInfo));
+            return shaderInfo;
         }
     };
 
@@ -127,6 +133,7 @@ namespace IW4
         TechniqueZoneLoadingState* const m_zone_state;
         techset::TechniqueStateMapCache* const m_state_map_cache;
         ShaderInfoFromFileSystemCacheState* const m_shader_info_cache;
+        ShaderAnalysisSessionState* const m_shader_analysis_state;
 
     public:
         class PassShaderArgument
@@ -177,13 +184,11 @@ namespace IW4
         {
             XAssetInfo<MaterialVertexShader>* m_vertex_shader;
             const d3d9::ShaderInfo* m_vertex_shader_info;
-            std::unique_ptr<d3d9::ShaderInfo> m_vertex_shader_info_unq;
             std::vector<size_t> m_vertex_shader_argument_handled_offset;
             std::vector<bool> m_handled_vertex_shader_arguments;
 
             XAssetInfo<MaterialPixelShader>* m_pixel_shader;
             const d3d9::ShaderInfo* m_pixel_shader_info;
-            std::unique_ptr<d3d9::ShaderInfo> m_pixel_shader_info_unq;
             std::vector<size_t> m_pixel_shader_argument_handled_offset;
             std::vector<bool> m_handled_pixel_shader_arguments;
 
@@ -214,7 +219,8 @@ namespace IW4
               m_manager(manager),
               m_zone_state(zoneState),
               m_state_map_cache(stateMapCache),
-              m_shader_info_cache(shaderInfoCache)
+              m_shader_info_cache(shaderInfoCache),
+              m_shader_analysis_state(manager->GetAssetLoadingContext()->GetSessionAssetLoaderState<ShaderAnalysisSessionState>())
         {
         }
 
@@ -416,7 +422,8 @@ namespace IW4
 
         bool AcceptStateMap(const std::string& stateMapName, std::string& errorMessage) override
         {
-            const auto* stateMap = AssetLoaderTechniqueSet::LoadStateMapDefinition(stateMapName, m_search_path, m_state_map_cache);
+            auto* fileCache = m_manager->GetAssetLoadingContext()->GetSessionAssetLoaderState<techset::StateMapDefinitionFileCache>();
+            const auto* stateMap = AssetLoaderTechniqueSet::LoadStateMapDefinition(stateMapName, m_search_path, m_state_map_cache, fileCache);
 
             if (!stateMap)
             {
@@ -464,13 +471,13 @@ namespace IW4
 
             if (pass.m_vertex_shader->Asset()->name && pass.m_vertex_shader->Asset()->name[0] == ',')
             {
-                pass.m_vertex_shader_info = m_shader_info_cache->LoadShaderInfoFromDisk(m_search_path, AssetLoaderVertexShader::GetFileNameForAsset(vertexShaderName));
+                pass.m_vertex_shader_info = m_shader_info_cache->LoadShaderInfoFromDisk(m_search_path, AssetLoaderVertexShader::GetFileNameForAsset(vertexShaderName),
+                                                                                   m_shader_analysis_state->m_shader_info_cache);
             }
             else
             {
                 const auto& shaderLoadDef = pass.m_vertex_shader->Asset()->prog.loadDef;
-                pass.m_vertex_shader_info_unq = d3d9::ShaderAnalyser::GetShaderInfo(shaderLoadDef.program, shaderLoadDef.programSize * sizeof(uint32_t));
-                pass.m_vertex_shader_info = pass.m_vertex_shader_info_unq.get();
+                pass.m_vertex_shader_info = m_shader_analysis_state->m_shader_info_cache.GetShaderInfo(shaderLoadDef.program, shaderLoadDef.programSize * sizeof(uint32_t));
             }
 
             if (!pass.m_vertex_shader_info)
@@ -503,13 +510,13 @@ namespace IW4
 
             if (pass.m_pixel_shader->Asset()->name && pass.m_pixel_shader->Asset()->name[0] == ',')
             {
-                pass.m_pixel_shader_info = m_shader_info_cache->LoadShaderInfoFromDisk(m_search_path, AssetLoaderPixelShader::GetFileNameForAsset(pixelShaderName));
+                pass.m_pixel_shader_info = m_shader_info_cache->LoadShaderInfoFromDisk(m_search_path, AssetLoaderPixelShader::GetFileNameForAsset(pixelShaderName),
+                                                                                   m_shader_analysis_state->m_shader_info_cache);
             }
             else
             {
                 const auto& shaderLoadDef = pass.m_pixel_shader->Asset()->prog.loadDef;
-                pass.m_pixel_shader_info_unq = d3d9::ShaderAnalyser::GetShaderInfo(shaderLoadDef.program, shaderLoadDef.programSize * sizeof(uint32_t));
-                pass.m_pixel_shader_info = pass.m_pixel_shader_info_unq.get();
+                pass.m_pixel_shader_info = m_shader_analysis_state->m_shader_info_cache.GetShaderInfo(shaderLoadDef.program, shaderLoadDef.programSize * sizeof(uint32_t));
             }
 
             if (!pass.m_pixel_shader_info)
@@ -1293,41 +1300,73 @@ bool AssetLoaderTechniqueSet::CreateTechsetFromDefinition(const std::string& ass
     return true;
 }
 
-techset::TechsetDefinition* AssetLoaderTechniqueSet::LoadTechsetDefinition(const std::string& assetName, ISearchPath* searchPath, techset::TechsetDefinitionCache* definitionCache)
+bool AssetLoaderTechniqueSet::ReadFileContent(ISearchPath* searchPath, const std::string& fileName, std::string& fileContent)
+{
+    const auto file = searchPath->Open(fileName);
+    if (!file.IsOpen())
+        return false;
+
+    fileContent.resize(static_cast<size_t>(file.m_length));
+    file.m_stream->read(fileContent.data(), file.m_length);
+    fileContent.resize(static_cast<size_t>(file.m_stream->gcount()));
+
+    return true;
+}
+
+const techset::TechsetDefinition* AssetLoaderTechniqueSet::LoadTechsetDefinition(const std::string& assetName, ISearchPath* searchPath, techset::TechsetDefinitionCache* definitionCache,
+                                                                                  techset::TechsetDefinitionFileCache* fileCache)
 {
-    auto* cachedTechsetDefinition = definitionCache->GetCachedTechsetDefinition(assetName);
+    const auto* cachedTechsetDefinition = definitionCache->GetCachedTechsetDefinition(assetName);
     if (cachedTechsetDefinition)
         return cachedTechsetDefinition;
 
     const auto techsetFileName = GetTechsetFileName(assetName);
-    const auto file = searchPath->Open(techsetFileName);
-    if (!file.IsOpen())
+    std::string fileContent;
+    if (!ReadFileContent(searchPath, techsetFileName, fileContent))
         return nullptr;
 
-    const techset::TechsetFileReader reader(*file.m_stream, techsetFileName, techniqueTypeNames, std::extent_v<decltype(techniqueTypeNames)>);
-    auto techsetDefinition = reader.ReadTechsetDefinition();
-    auto* techsetDefinitionPtr = techsetDefinition.get();
+    auto fileHash = techset::TechsetDefinitionFileCache::HashFileContent(fileContent);
+    auto techsetDefinition = fileCache->GetParsedFile(techsetFileName, fileHash);
+    if (!techsetDefinition)
+    {
+        std::istringstream stream(fileContent);
+        const techset::TechsetFileReader reader(stream, techsetFileName, techniqueTypeNames, std::extent_v<decltype(techniqueTypeNames)>);
+        techsetDefinition = reader.ReadTechsetDefinition();
+        if (techsetDefinition)
+            fileCache->AddParsedFile(techsetFileName, std::move(fileHash), techsetDefinition);
+    }
+
+    const auto* techsetDefinitionPtr = techsetDefinition.get();
 
     definitionCache->AddTechsetDefinitionToCache(assetName, std::move(techsetDefinition));
 
     return techsetDefinitionPtr;
 }
 
-const state_map::StateMapDefinition* AssetLoaderTechniqueSet::LoadStateMapDefinition(const std::string& stateMapName, ISearchPath* searchPath, techset::TechniqueStateMapCache* stateMapCache)
+const state_map::StateMapDefinition* AssetLoaderTechniqueSet::LoadStateMapDefinition(const std::string& stateMapName, ISearchPath* searchPath, techset::TechniqueStateMapCache* stateMapCache,
+                                                                                      techset::StateMapDefinitionFileCache* fileCache)
 {
     auto* cachedStateMap = stateMapCache->GetCachedStateMap(stateMapName);
     if (cachedStateMap)
         return cachedStateMap;
 
     const auto stateMapFileName = GetStateMapFileName(stateMapName);
-    const auto file = searchPath->Open(stateMapFileName);
-    if (!file.IsOpen())
+    std::string fileContent;
+    if (!ReadFileContent(searchPath, stateMapFileName, fileContent))
         return nullptr;
 
-    const state_map::StateMapReader reader(*file.m_stream, stateMapFileName, stateMapName, stateMapLayout);
-    auto stateMapDefinition = reader.ReadStateMapDefinition();
+    auto fileHash = techset::StateMapDefinitionFileCache::HashFileContent(fileContent);
+    auto stateMapDefinition = fileCache->GetParsedFile(stateMapFileName, fileHash);
     if (!stateMapDefinition)
-        return nullptr;
+    {
+        std::istringstream stream(fileContent);
+        const state_map::StateMapReader reader(stream, stateMapFileName, stateMapName, stateMapLayout);
+        stateMapDefinition = reader.ReadStateMapDefinition();
+        if (!stateMapDefinition)
+            return nullptr;
+
+        fileCache->AddParsedFile(stateMapFileName, std::move(fileHash), stateMapDefinition);
+    }
 
     const auto* stateMapDefinitionPtr = stateMapDefinition.get();
 
@@ -1344,7 +1383,8 @@ bool AssetLoaderTechniqueSet::CanLoadFromRaw() const
 bool AssetLoaderTechniqueSet::LoadFromRaw(const std::string& assetName, ISearchPath* searchPath, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const
 {
     auto* definitionCache = manager->GetAssetLoadingContext()->GetZoneAssetLoaderState<techset::TechsetDefinitionCache>();
-    const auto* techsetDefinition = LoadTechsetDefinition(assetName, searchPath, definitionCache);
+    auto* fileCache = manager->GetAssetLoadingContext()->GetSessionAssetLoaderState<techset::TechsetDefinitionFileCache>();
+    const auto* techsetDefinition = LoadTechsetDefinition(assetName, searchPath, definitionCache, fileCache);
     if (techsetDefinition)
         return CreateTechsetFromDefinition(assetName, *techsetDefinition, searchPath, memory, manager);
 
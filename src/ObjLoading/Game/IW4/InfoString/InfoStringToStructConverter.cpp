@@ -14,7 +14,7 @@ InfoStringToStructConverter::InfoStringToStructConverter(const InfoString& infoS
 {
 }
 
-bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, const std::string& value)
+bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, const std::string_view& value)
 {
     switch (static_cast<csParseFieldType_t>(field.iFieldType))
     {
@@ -53,7 +53,7 @@ bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, cons
                 return true;
             }
 
-            auto* fx = m_loading_manager->LoadDependency(ASSET_TYPE_FX, value);
+            auto* fx = m_loading_manager->LoadDependency(ASSET_TYPE_FX, std::string(value));
 
             if (fx == nullptr)
             {
@@ -75,7 +75,7 @@ bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, cons
                 return true;
             }
 
-            auto* xmodel = m_loading_manager->LoadDependency(ASSET_TYPE_XMODEL, value);
+            auto* xmodel = m_loading_manager->LoadDependency(ASSET_TYPE_XMODEL, std::string(value));
 
             if (xmodel == nullptr)
             {
@@ -97,7 +97,7 @@ bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, cons
                 return true;
             }
 
-            auto* material = m_loading_manager->LoadDependency(ASSET_TYPE_MATERIAL, value);
+            auto* material = m_loading_manager->LoadDependency(ASSET_TYPE_MATERIAL, std::string(value));
 
             if (material == nullptr)
             {
@@ -119,7 +119,7 @@ bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, cons
                 return true;
             }
 
-            auto* tracer = m_loading_manager->LoadDependency(ASSET_TYPE_TRACER, value);
+            auto* tracer = m_loading_manager->LoadDependency(ASSET_TYPE_TRACER, std::string(value));
 
             if (tracer == nullptr)
             {
@@ -135,10 +135,11 @@ bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, cons
 
     case CSPFT_MPH_TO_INCHES_PER_SEC:
         {
-            char* endPtr;
-            *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + field.iOffset) = strtof(value.c_str(), &endPtr) * 17.6f;
+            float mphValue;
+            const auto success = ParseFloat(value, mphValue);
+            *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + field.iOffset) = mphValue * 17.6f;
 
-            if (endPtr != &value[value.size()])
+            if (!success)
             {
                 std::cout << "Failed to parse value \"" << value << "\" as mph" << std::endl;
                 return false;
@@ -155,7 +156,7 @@ bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, cons
                 return true;
             }
 
-            auto* collmap = m_loading_manager->LoadDependency(ASSET_TYPE_PHYSCOLLMAP, value);
+            auto* collmap = m_loading_manager->LoadDependency(ASSET_TYPE_PHYSCOLLMAP, std::string(value));
 
             if (collmap == nullptr)
             {
@@ -177,7 +178,7 @@ bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, cons
                 return true;
             }
 
-            auto* sound = m_loading_manager->LoadDependency(ASSET_TYPE_SOUND, value);
+            auto* sound = m_loading_manager->LoadDependency(ASSET_TYPE_SOUND, std::string(value));
 
             if (sound == nullptr)
             {
@@ -200,24 +201,26 @@ bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, cons
 
 bool InfoStringToStructConverter::Convert()
 {
+    std::vector<InfoStringConversionPlan::FieldValue> fieldValues;
+    GetConversionPlan(m_fields, m_field_count).CollectValues(m_info_string, fieldValues);
+
+    // Fields are still converted in field order to keep script string and dependency order stable
     for (auto fieldIndex = 0u; fieldIndex < m_field_count; fieldIndex++)
     {
         const auto& field = m_fields[fieldIndex];
         assert(field.iFieldType >= 0);
 
-        auto foundValue = false;
-        const auto& value = m_info_string.GetValueForKey(std::string(field.szName), &foundValue);
-
-        if (foundValue)
+        const auto& fieldValue = fieldValues[fieldIndex];
+        if (fieldValue.m_found)
         {
             if (field.iFieldType < CSPFT_NUM_BASE_FIELD_TYPES)
             {
-                if (!ConvertBaseField(field, value))
+                if (!ConvertBaseField(field, fieldValue.m_value))
                     return false;
             }
             else
             {
-                if (!ConvertExtensionField(field, value))
+                if (!ConvertExtensionField(field, fieldValue.m_value))
                     return false;
             }
         }
@@ -12,8 +12,8 @@ namespace IW4
         const cspField_t* m_fields;
         size_t m_field_count;
 
-        virtual bool ConvertExtensionField(const cspField_t& field, const std::string& value) = 0;
-        bool ConvertBaseField(const cspField_t& field, const std::string& value);
+        virtual bool ConvertExtensionField(const cspField_t& field, const std::string_view& value) = 0;
+        bool ConvertBaseField(const cspField_t& field, const std::string_view& value);
 
     public:
         InfoStringToStructConverter(const InfoString& infoString, void* structure, ZoneScriptStrings& zoneScriptStrings, MemoryManager* memory, IAssetLoadingManager* manager, const cspField_t* fields,
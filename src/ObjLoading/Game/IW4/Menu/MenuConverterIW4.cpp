@@ -14,6 +14,7 @@
 #include "Parsing/Menu/Domain/Expression/CommonExpressionBaseFunctionCall.h"
 #include "Parsing/Menu/Domain/Expression/CommonExpressionCustomFunctionCall.h"
 #include "Parsing/Simple/Expression/SimpleExpressionBinaryOperation.h"
+#include "Parsing/Simple/Expression/SimpleExpressionBytecode.h"
 #include "Parsing/Simple/Expression/SimpleExpressionConditionalOperator.h"
 #include "Parsing/Simple/Expression/SimpleExpressionUnaryOperation.h"
 
@@ -178,7 +179,8 @@ namespace IW4
                     else
                         firstArg = false;
 
-                    ConvertExpressionEntry(gameStatement, entries, arg.get(), menu, item);
+                    const SimpleExpressionBytecode argBytecode(arg.get());
+                    ConvertExpressionEntry(gameStatement, entries, argBytecode, arg.get(), menu, item);
                 }
 
                 expressionEntry parenRight{};
@@ -223,15 +225,15 @@ namespace IW4
             OP_SUBTRACT
         };
 
-        bool IsOperation(const ISimpleExpression* expression) const
+        bool IsOperation(const SimpleExpressionBytecode& bytecode, const ISimpleExpression* expression) const
         {
-            if (!m_disable_optimizations && expression->IsStatic())
+            if (!m_disable_optimizations && bytecode.IsStatic(expression))
                 return false;
 
             return dynamic_cast<const SimpleExpressionBinaryOperation*>(expression) || dynamic_cast<const SimpleExpressionUnaryOperation*>(expression);
         }
 
-        void ConvertExpressionEntryUnaryOperation(Statement_s* gameStatement, std::vector<expressionEntry>& entries, const SimpleExpressionUnaryOperation* unaryOperation, const CommonMenuDef* menu,
+        void ConvertExpressionEntryUnaryOperation(Statement_s* gameStatement, std::vector<expressionEntry>& entries, const SimpleExpressionBytecode& bytecode, const SimpleExpressionUnaryOperation* unaryOperation, const CommonMenuDef* menu,
                                                   const CommonItemDef* item) const
         {
             assert(static_cast<unsigned>(unaryOperation->m_operation_type->m_id) < static_cast<unsigned>(SimpleUnaryOperationId::COUNT));
@@ -240,14 +242,14 @@ namespace IW4
             operation.data.op = UNARY_OPERATION_MAPPING[static_cast<unsigned>(unaryOperation->m_operation_type->m_id)];
             entries.emplace_back(operation);
 
-            if (IsOperation(unaryOperation->m_operand.get()))
+            if (IsOperation(bytecode, unaryOperation->m_operand.get()))
             {
                 expressionEntry parenLeft{};
                 parenLeft.type = EET_OPERATOR;
                 parenLeft.data.op = OP_LEFTPAREN;
                 entries.emplace_back(parenLeft);
 
-                ConvertExpressionEntry(gameStatement, entries, unaryOperation->m_operand.get(), menu, item);
+                ConvertExpressionEntry(gameStatement, entries, bytecode, unaryOperation->m_operand.get(), menu, item);
 
                 expressionEntry parenRight{};
                 parenRight.type = EET_OPERATOR;
@@ -255,7 +257,7 @@ namespace IW4
                 entries.emplace_back(parenRight);
             }
             else
-                ConvertExpressionEntry(gameStatement, entries, unaryOperation->m_operand.get(), menu, item);
+                ConvertExpressionEntry(gameStatement, entries, bytecode, unaryOperation->m_operand.get(), menu, item);
         }
 
         constexpr static expressionOperatorType_e BINARY_OPERATION_MAPPING[static_cast<unsigned>(SimpleBinaryOperationId::COUNT)]
@@ -279,18 +281,18 @@ namespace IW4
             OP_OR
         };
 
-        void ConvertExpressionEntryBinaryOperation(Statement_s* gameStatement, std::vector<expressionEntry>& entries, const SimpleExpressionBinaryOperation* binaryOperation, const CommonMenuDef* menu,
+        void ConvertExpressionEntryBinaryOperation(Statement_s* gameStatement, std::vector<expressionEntry>& entries, const SimpleExpressionBytecode& bytecode, const SimpleExpressionBinaryOperation* binaryOperation, const CommonMenuDef* menu,
                                                    const CommonItemDef* item) const
         {
             // Game needs all nested operations to have parenthesis
-            if (IsOperation(binaryOperation->m_operand1.get()))
+            if (IsOperation(bytecode, binaryOperation->m_operand1.get()))
             {
                 expressionEntry parenLeft{};
                 parenLeft.type = EET_OPERATOR;
                 parenLeft.data.op = OP_LEFTPAREN;
                 entries.emplace_back(parenLeft);
 
-                ConvertExpressionEntry(gameStatement, entries, binaryOperation->m_operand1.get(), menu, item);
+                ConvertExpressionEntry(gameStatement, entries, bytecode, binaryOperation->m_operand1.get(), menu, item);
 
                 expressionEntry parenRight{};
                 parenRight.type = EET_OPERATOR;
@@ -298,7 +300,7 @@ namespace IW4
                 entries.emplace_back(parenRight);
             }
             else
-                ConvertExpressionEntry(gameStatement, entries, binaryOperation->m_operand1.get(), menu, item);
+                ConvertExpressionEntry(gameStatement, entries, bytecode, binaryOperation->m_operand1.get(), menu, item);
 
             assert(static_cast<unsigned>(binaryOperation->m_operation_type->m_id) < static_cast<unsigned>(SimpleBinaryOperationId::COUNT));
             expressionEntry operation{};
@@ -307,14 +309,14 @@ namespace IW4
             entries.emplace_back(operation);
 
             // Game needs all nested operations to have parenthesis
-            if (IsOperation(binaryOperation->m_operand2.get()))
+            if (IsOperation(bytecode, binaryOperation->m_operand2.get()))
             {
                 expressionEntry parenLeft{};
                 parenLeft.type = EET_OPERATOR;
                 parenLeft.data.op = OP_LEFTPAREN;
                 entries.emplace_back(parenLeft);
 
-                ConvertExpressionEntry(gameStatement, entries, binaryOperation->m_operand2.get(), menu, item);
+                ConvertExpressionEntry(gameStatement, entries, bytecode, binaryOperation->m_operand2.get(), menu, item);
 
                 expressionEntry parenRight{};
                 parenRight.type = EET_OPERATOR;
@@ -322,7 +324,7 @@ namespace IW4
                 entries.emplace_back(parenRight);
             }
             else
-                ConvertExpressionEntry(gameStatement, entries, binaryOperation->m_operand2.get(), menu, item);
+                ConvertExpressionEntry(gameStatement, entries, bytecode, binaryOperation->m_operand2.get(), menu, item);
         }
 
         void ConvertExpressionEntryExpressionValue(std::vector<expressionEntry>& entries, const SimpleExpressionValue* expressionValue) const
@@ -349,11 +351,12 @@ namespace IW4
             entries.emplace_back(entry);
         }
 
-        void ConvertExpressionEntry(Statement_s* gameStatement, std::vector<expressionEntry>& entries, const ISimpleExpression* expression, const CommonMenuDef* menu, const CommonItemDef* item) const
+        void ConvertExpressionEntry(Statement_s* gameStatement, std::vector<expressionEntry>& entries, const SimpleExpressionBytecode& bytecode, const ISimpleExpression* expression, const CommonMenuDef* menu,
+                                    const CommonItemDef* item) const
         {
-            if (!m_disable_optimizations && expression->IsStatic())
+            if (!m_disable_optimizations && bytecode.IsStatic(expression))
             {
-                const auto expressionStaticValue = expression->EvaluateStatic();
+                const auto expressionStaticValue = bytecode.EvaluateStatic(expression);
                 ConvertExpressionEntryExpressionValue(entries, &expressionStaticValue);
             }
             else if (const auto* expressionValue = dynamic_cast<const SimpleExpressionValue*>(expression))
@@ -362,11 +365,11 @@ namespace IW4
             }
             else if (const auto* binaryOperation = dynamic_cast<const SimpleExpressionBinaryOperation*>(expression))
             {
-                ConvertExpressionEntryBinaryOperation(gameStatement, entries, binaryOperation, menu, item);
+                ConvertExpressionEntryBinaryOperation(gameStatement, entries, bytecode, binaryOperation, menu, item);
             }
             else if (const auto* unaryOperation = dynamic_cast<const SimpleExpressionUnaryOperation*>(expression))
             {
-                ConvertExpressionEntryUnaryOperation(gameStatement, entries, unaryOperation, menu, item);
+                ConvertExpressionEntryUnaryOperation(gameStatement, entries, bytecode, unaryOperation, menu, item);
             }
             else if (const auto* baseFunctionCall = dynamic_cast<const CommonExpressionBaseFunctionCall*>(expression))
             {
@@ -397,8 +400,10 @@ namespace IW4
             statement->lastExecuteTime = 0;
             statement->supportingData = nullptr; // Supporting data is set upon using it
 
+            // Compiling the expression once makes checking every part of it for being static cheap
+            const SimpleExpressionBytecode bytecode(expression);
             std::vector<expressionEntry> expressionEntries;
-            ConvertExpressionEntry(statement, expressionEntries, expression, menu, item);
+            ConvertExpressionEntry(statement, expressionEntries, bytecode, expression, menu, item);
 
             auto* outputExpressionEntries = static_cast<expressionEntry*>(m_memory->Alloc(sizeof(expressionEntry) * expressionEntries.size()));
             memcpy(outputExpressionEntries, expressionEntries.data(), sizeof(expressionEntry) * expressionEntries.size());
@@ -86,20 +86,17 @@ namespace IW5
             return menuListAsset;
         }
 
-        static std::unique_ptr<menu::ParsingResult> ParseMenuFile(const std::string& menuFileName, ISearchPath* searchPath, const menu::MenuAssetZoneState* zoneState)
+        static std::unique_ptr<menu::ParsingResult> ParseMenuFile(const std::string& menuFileName, ISearchPath* searchPath, menu::MenuAssetZoneState* zoneState)
         {
             const auto file = searchPath->Open(menuFileName);
             if (!file.IsOpen())
                 return nullptr;
 
-            menu::MenuFileReader reader(*file.m_stream, menuFileName, menu::FeatureLevel::IW5, [searchPath](const std::string& filename, const std::string& sourceFile) -> std::unique_ptr<std::istream>
+            auto* includeFileCache = &zoneState->m_include_file_cache;
+            menu::MenuFileReader reader(*file.m_stream, menuFileName, menu::FeatureLevel::IW5, [searchPath, includeFileCache](const std::string& filename, const std::string& sourceFile) -> std::unique_ptr<std::istream>
             {
-                auto foundFileToInclude = searchPath->Open(filename);
-                if (!foundFileToInclude.IsOpen() || !foundFileToInclude.m_stream)
-                    return nullptr;
-
-                return std::move(foundFileToInclude.m_stream);
-            });
+                return includeFileCache->Open(filename, searchPath);
+            }, &includeFileCache->GetPreprocessedIncludes());
 
             reader.IncludeZoneState(zoneState);
             reader.SetPermissiveMode(ObjLoading::Configuration.MenuPermissiveParsing);
@@ -201,7 +198,8 @@ bool AssetLoaderMenuList::LoadFromRaw(const std::string& assetName, ISearchPath*
     return true;
 }
 
-void AssetLoaderMenuList::FinalizeAssetsForZone(AssetLoadingContext* context) const
+bool AssetLoaderMenuList::FinalizeAssetsForZone(AssetLoadingContext* context) const
 {
     context->GetZoneAssetLoaderState<MenuConversionZoneState>()->FinalizeSupportingData();
+    return true;
 }
@@ -3,8 +3,10 @@
 #include <cstring>
 #include <filesystem>
 #include <iostream>
+#include <vector>
 #include <zlib.h>
 
+#include "AssetLoading/AssetLoadingTaskZoneState.h"
 #include "Game/IW5/IW5.h"
 #include "Pool/GlobalAssetPool.h"
 
@@ -29,49 +31,66 @@ bool AssetLoaderRawFile::LoadFromRaw(const std::string& assetName, ISearchPath*
     if (!file.IsOpen())
         return false;
 
-    const auto uncompressedBuffer = std::make_unique<char[]>(static_cast<size_t>(file.m_length));
-    file.m_stream->read(uncompressedBuffer.get(), file.m_length);
+    std::vector<char> uncompressedBuffer(static_cast<size_t>(file.m_length));
+    file.m_stream->read(uncompressedBuffer.data(), file.m_length);
     if (file.m_stream->gcount() != file.m_length)
         return false;
 
     const auto compressionBufferSize = static_cast<size_t>(file.m_length + COMPRESSED_BUFFER_SIZE_PADDING);
     auto* compressedBuffer = static_cast<char*>(memory->Alloc(compressionBufferSize));
 
-    z_stream_s zs{};
-
-    zs.zalloc = Z_NULL;
-    zs.zfree = Z_NULL;
-    zs.opaque = Z_NULL;
-    zs.avail_in = static_cast<uInt>(file.m_length);
-    zs.avail_out = compressionBufferSize;
-    zs.next_in = reinterpret_cast<const Bytef*>(uncompressedBuffer.get());
-    zs.next_out = reinterpret_cast<Bytef*>(compressedBuffer);
-
-    int ret = deflateInit(&zs, Z_DEFAULT_COMPRESSION);
-
-    if (ret != Z_OK)
-    {
-        throw std::runtime_error("Initializing deflate failed");
-    }
+    auto* rawFile = memory->Create<RawFile>();
+    rawFile->name = memory->Dup(assetName.c_str());
+    rawFile->compressedLen = 0;
+    rawFile->len = static_cast<int>(file.m_length);
+    rawFile->buffer = static_cast<const char*>(compressedBuffer);
 
-    ret = deflate(&zs, Z_FINISH);
+    auto* assetInfo = manager->AddAsset(ASSET_TYPE_RAWFILE, assetName, rawFile);
+    if (assetInfo == nullptr)
+        return true;
 
-    if (ret != Z_STREAM_END)
+    // Compressing does not depend on any other asset so it can be done while the remaining assets are loaded
+    auto* loadedRawFile = static_cast<RawFile*>(assetInfo->m_ptr);
+    auto* taskState = manager->GetAssetLoadingContext()->GetZoneAssetLoaderState<AssetLoadingTaskZoneState>();
+    taskState->Enqueue(uncompressedBuffer.size(), [assetName, loadedRawFile, compressedBuffer, compressionBufferSize, uncompressedBuffer = std::move(uncompressedBuffer)]
     {
-        std::cout << "Deflate failed for loading rawfile \"" << assetName << "\"" << std::endl;
+        z_stream_s zs{};
+
+        zs.zalloc = Z_NULL;
+        zs.zfree = Z_NULL;
+        zs.opaque = Z_NULL;
+        zs.avail_in = static_cast<uInt>(uncompressedBuffer.size());
+        zs.avail_out = compressionBufferSize;
+        zs.next_in = reinterpret_cast<const Bytef*>(uncompressedBuffer.data());
+        zs.next_out = reinterpret_cast<Bytef*>(compressedBuffer);
+
+        // The asset was already added to the zone, so a failure is reported when finalizing and fails the whole zone
+        int ret = deflateInit(&zs, Z_DEFAULT_COMPRESSION);
+
+        if (ret != Z_OK)
+        {
+            std::cout << "Initializing deflate failed for loading rawfile \"" << assetName << "\"" << std::endl;
+            return false;
+        }
+
+        ret = deflate(&zs, Z_FINISH);
         deflateEnd(&zs);
-        return false;
-    }
 
-    const auto compressedSize = compressionBufferSize - zs.avail_out;
+        if (ret != Z_STREAM_END)
+        {
+            std::cout << "Deflate failed for loading rawfile \"" << assetName << "\"" << std::endl;
+            return false;
+        }
 
-    auto* rawFile = memory->Create<RawFile>();
-    rawFile->name = memory->Dup(assetName.c_str());
-    rawFile->compressedLen = static_cast<int>(compressedSize);
-    rawFile->len = static_cast<int>(file.m_length);
-    rawFile->buffer = static_cast<const char*>(compressedBuffer);
+        loadedRawFile->compressedLen = static_cast<int>(compressionBufferSize - zs.avail_out);
 
-    manager->AddAsset(ASSET_TYPE_RAWFILE, assetName, rawFile);
+        return true;
+    });
 
     return true;
 }
+
+bool AssetLoaderRawFile::FinalizeAssetsForZone(AssetLoadingContext* context) const
+{
+    return context->GetZoneAssetLoaderState<AssetLoadingTaskZoneState>()->WaitForTasks();
+}
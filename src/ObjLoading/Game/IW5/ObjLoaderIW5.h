@@ -32,6 +32,6 @@ namespace IW5
         void LoadObjDataForZone(ISearchPath* searchPath, Zone* zone) const override;
 
         bool LoadAssetForZone(AssetLoadingContext* context, asset_type_t assetType, const std::string& assetName) const override;
-        void FinalizeAssetsForZone(AssetLoadingContext* context) const override;
+        bool FinalizeAssetsForZone(AssetLoadingContext* context) const override;
     };
 }
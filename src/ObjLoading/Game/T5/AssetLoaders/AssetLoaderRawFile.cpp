@@ -3,8 +3,10 @@
 #include <cstring>
 #include <filesystem>
 #include <iostream>
+#include <vector>
 #include <zlib.h>
 
+#include "AssetLoading/AssetLoadingTaskZoneState.h"
 #include "Game/T5/T5.h"
 #include "Pool/GlobalAssetPool.h"
 
@@ -27,8 +29,8 @@ bool AssetLoaderRawFile::CanLoadFromRaw() const
 
 bool AssetLoaderRawFile::LoadGsc(const SearchPathOpenFile& file, const std::string& assetName, ISearchPath* searchPath, MemoryManager* memory, IAssetLoadingManager* manager)
 {
-    const auto uncompressedBuffer = std::make_unique<char[]>(static_cast<size_t>(file.m_length + 1));
-    file.m_stream->read(uncompressedBuffer.get(), file.m_length);
+    std::vector<char> uncompressedBuffer(static_cast<size_t>(file.m_length + 1));
+    file.m_stream->read(uncompressedBuffer.data(), file.m_length);
     if (file.m_stream->gcount() != file.m_length)
         return false;
     uncompressedBuffer[static_cast<size_t>(file.m_length)] = '\0';
@@ -36,43 +38,57 @@ bool AssetLoaderRawFile::LoadGsc(const SearchPathOpenFile& file, const std::stri
     const auto compressionBufferSize = static_cast<size_t>(file.m_length + 1 + sizeof(uint32_t) + sizeof(uint32_t) + COMPRESSED_BUFFER_SIZE_PADDING);
     auto* compressedBuffer = static_cast<char*>(memory->Alloc(compressionBufferSize));
 
-    z_stream_s zs{};
-
-    zs.zalloc = Z_NULL;
-    zs.zfree = Z_NULL;
-    zs.opaque = Z_NULL;
-    zs.avail_in = static_cast<uInt>(file.m_length + 1);
-    zs.avail_out = compressionBufferSize;
-    zs.next_in = reinterpret_cast<const Bytef*>(uncompressedBuffer.get());
-    zs.next_out = reinterpret_cast<Bytef*>(&compressedBuffer[sizeof(uint32_t) + sizeof(uint32_t)]);
-
-    int ret = deflateInit(&zs, Z_DEFAULT_COMPRESSION);
-
-    if (ret != Z_OK)
-    {
-        throw std::runtime_error("Initializing deflate failed");
-    }
+    auto* rawFile = memory->Create<RawFile>();
+    rawFile->name = memory->Dup(assetName.c_str());
+    rawFile->len = 0;
+    rawFile->buffer = static_cast<const char*>(compressedBuffer);
 
-    ret = deflate(&zs, Z_FINISH);
+    auto* assetInfo = manager->AddAsset(ASSET_TYPE_RAWFILE, assetName, rawFile);
+    if (assetInfo == nullptr)
+        return true;
 
-    if (ret != Z_STREAM_END)
+    // Compressing does not depend on any other asset so it can be done while the remaining assets are loaded
+    auto* loadedRawFile = static_cast<RawFile*>(assetInfo->m_ptr);
+    auto* taskState = manager->GetAssetLoadingContext()->GetZoneAssetLoaderState<AssetLoadingTaskZoneState>();
+    taskState->Enqueue(uncompressedBuffer.size(), [assetName, loadedRawFile, compressedBuffer, compressionBufferSize, uncompressedBuffer = std::move(uncompressedBuffer)]
     {
-        std::cout << "Deflate failed for loading gsc file \"" << assetName << "\"" << std::endl;
+        z_stream_s zs{};
+
+        zs.zalloc = Z_NULL;
+        zs.zfree = Z_NULL;
+        zs.opaque = Z_NULL;
+        zs.avail_in = static_cast<uInt>(uncompressedBuffer.size());
+        zs.avail_out = compressionBufferSize;
+        zs.next_in = reinterpret_cast<const Bytef*>(uncompressedBuffer.data());
+        zs.next_out = reinterpret_cast<Bytef*>(&compressedBuffer[sizeof(uint32_t) + sizeof(uint32_t)]);
+
+        // The asset was already added to the zone, so a failure is reported when finalizing and fails the whole zone
+        int ret = deflateInit(&zs, Z_DEFAULT_COMPRESSION);
+
+        if (ret != Z_OK)
+        {
+            std::cout << "Initializing deflate failed for loading gsc file \"" << assetName << "\"" << std::endl;
+            return false;
+        }
+
+        ret = deflate(&zs, Z_FINISH);
         deflateEnd(&zs);
-        return false;
-    }
 
-    const auto compressedSize = compressionBufferSize - zs.avail_out;
+        if (ret != Z_STREAM_END)
+        {
+            std::cout << "Deflate failed for loading gsc file \"" << assetName << "\"" << std::endl;
+            return false;
+        }
 
-    reinterpret_cast<uint32_t*>(compressedBuffer)[0] = static_cast<uint32_t>(file.m_length + 1); // outLen
-    reinterpret_cast<uint32_t*>(compressedBuffer)[1] = compressedSize; // inLen
+        const auto compressedSize = compressionBufferSize - zs.avail_out;
 
-    auto* rawFile = memory->Create<RawFile>();
-    rawFile->name = memory->Dup(assetName.c_str());
-    rawFile->len = static_cast<int>(compressedSize + sizeof(uint32_t) + sizeof(uint32_t));
-    rawFile->buffer = static_cast<const char*>(compressedBuffer);
+        reinterpret_cast<uint32_t*>(compressedBuffer)[0] = static_cast<uint32_t>(uncompressedBuffer.size()); // outLen
+        reinterpret_cast<uint32_t*>(compressedBuffer)[1] = compressedSize; // inLen
 
-    manager->AddAsset(ASSET_TYPE_RAWFILE, assetName, rawFile);
+        loadedRawFile->len = static_cast<int>(compressedSize + sizeof(uint32_t) + sizeof(uint32_t));
+
+        return true;
+    });
 
     return true;
 }
@@ -109,3 +125,8 @@ bool AssetLoaderRawFile::LoadFromRaw(const std::string& assetName, ISearchPath*
 
     return LoadDefault(file, assetName, searchPath, memory, manager);
 }
+
+bool AssetLoaderRawFile::FinalizeAssetsForZone(AssetLoadingContext* context) const
+{
+    return context->GetZoneAssetLoaderState<AssetLoadingTaskZoneState>()->WaitForTasks();
+}
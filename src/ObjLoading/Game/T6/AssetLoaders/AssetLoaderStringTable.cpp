@@ -34,7 +34,7 @@ bool AssetLoaderStringTable::LoadFromRaw(const std::string& assetName, ISearchPa
     std::vector<std::vector<std::string>> csvLines;
     std::vector<std::string> currentLine;
     auto maxCols = 0u;
-    const CsvInputStream csv(*file.m_stream);
+    CsvInputStream csv(*file.m_stream);
 
     while (csv.NextRow(currentLine))
     {
@@ -18,7 +18,7 @@ namespace T6
     class InfoStringToTracerConverter final : public InfoStringToStructConverter
     {
     protected:
-        bool ConvertExtensionField(const cspField_t& field, const std::string& value) override
+        bool ConvertExtensionField(const cspField_t& field, const std::string_view& value) override
         {
             switch (static_cast<tracerFieldType_t>(field.iFieldType))
             {
@@ -18,7 +18,7 @@ namespace T6
     class InfoStringToVehicleConverter final : public InfoStringToStructConverter
     {
     protected:
-        bool ConvertExtensionField(const cspField_t& field, const std::string& value) override
+        bool ConvertExtensionField(const cspField_t& field, const std::string_view& value) override
         {
             switch (static_cast<VehicleFieldType>(field.iFieldType))
             {
@@ -33,29 +33,27 @@ namespace T6
 
             case VFT_MPH_TO_INCHES_PER_SECOND:
                 {
-                    char* endPtr;
-                    *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + field.iOffset) = strtof(value.c_str(), &endPtr) * 17.6f;
-
-                    if (endPtr != &value[value.size()])
+                    float floatValue;
+                    if (!ParseFloat(value, floatValue))
                     {
                         std::cout << "Failed to parse value \"" << value << "\" as mph" << std::endl;
                         return false;
                     }
 
+                    *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + field.iOffset) = floatValue * 17.6f;
                     return true;
                 }
 
             case VFT_POUNDS_TO_GAME_MASS:
                 {
-                    char* endPtr;
-                    *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + field.iOffset) = strtof(value.c_str(), &endPtr) * 0.001f;
-
-                    if (endPtr != &value[value.size()])
+                    float floatValue;
+                    if (!ParseFloat(value, floatValue))
                     {
                         std::cout << "Failed to parse value \"" << value << "\" as pounds" << std::endl;
                         return false;
                     }
 
+                    *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + field.iOffset) = floatValue * 0.001f;
                     return true;
                 }
 
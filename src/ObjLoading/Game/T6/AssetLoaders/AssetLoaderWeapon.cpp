@@ -20,7 +20,7 @@ namespace T6
 {
     class InfoStringToWeaponConverter final : public InfoStringToStructConverter
     {
-        bool ConvertHideTags(const cspField_t& field, const std::string& value)
+        bool ConvertHideTags(const cspField_t& field, const std::string_view& value)
         {
             std::vector<std::string> valueArray;
             if (!ParseAsArray(value, valueArray))
@@ -58,7 +58,7 @@ namespace T6
             return true;
         }
 
-        _NODISCARD bool ConvertBounceSounds(const cspField_t& field, const std::string& value) const
+        _NODISCARD bool ConvertBounceSounds(const cspField_t& field, const std::string_view& value) const
         {
             auto*** bounceSound = reinterpret_cast<const char***>(reinterpret_cast<uintptr_t>(m_structure) + field.iOffset);
             if (value.empty())
@@ -71,13 +71,13 @@ namespace T6
             *bounceSound = static_cast<const char**>(m_memory->Alloc(sizeof(const char*) * SURF_TYPE_NUM));
             for (auto i = 0u; i < SURF_TYPE_NUM; i++)
             {
-                const auto currentBounceSound = value + bounceSoundSuffixes[i];
+                const auto currentBounceSound = std::string(value) + bounceSoundSuffixes[i];
                 (*bounceSound)[i] = m_memory->Dup(currentBounceSound.c_str());
             }
             return true;
         }
 
-        _NODISCARD bool ConvertNotetrackSoundMap(const cspField_t& field, const std::string& value)
+        _NODISCARD bool ConvertNotetrackSoundMap(const cspField_t& field, const std::string_view& value)
         {
             std::vector<std::pair<std::string, std::string>> pairs;
             if (!ParseAsPairs(value, pairs))
@@ -120,7 +120,7 @@ namespace T6
             return true;
         }
 
-        _NODISCARD bool ConvertWeaponCamo(const cspField_t& field, const std::string& value)
+        _NODISCARD bool ConvertWeaponCamo(const cspField_t& field, const std::string_view& value)
         {
             if (value.empty())
             {
@@ -128,7 +128,7 @@ namespace T6
                 return true;
             }
 
-            auto* camo = m_loading_manager->LoadDependency(ASSET_TYPE_WEAPON_CAMO, value);
+            auto* camo = m_loading_manager->LoadDependency(ASSET_TYPE_WEAPON_CAMO, std::string(value));
 
             if (camo == nullptr)
             {
@@ -142,7 +142,7 @@ namespace T6
             return true;
         }
 
-        _NODISCARD bool ConvertAttachments(const cspField_t& field, const std::string& value)
+        _NODISCARD bool ConvertAttachments(const cspField_t& field, const std::string_view& value)
         {
             std::vector<std::string> valueArray;
             if (!ParseAsArray(value, valueArray))
@@ -191,7 +191,7 @@ namespace T6
             return (mask & (mask - 1)) != 0;
         }
 
-        _NODISCARD bool ConvertAttachmentUniques(const cspField_t& field, const std::string& value)
+        _NODISCARD bool ConvertAttachmentUniques(const cspField_t& field, const std::string_view& value)
         {
             std::vector<std::string> valueArray;
             if (!ParseAsArray(value, valueArray))
@@ -252,7 +252,7 @@ namespace T6
         }
 
     protected:
-        bool ConvertExtensionField(const cspField_t& field, const std::string& value) override
+        bool ConvertExtensionField(const cspField_t& field, const std::string_view& value) override
         {
             switch (static_cast<weapFieldType_t>(field.iFieldType))
             {
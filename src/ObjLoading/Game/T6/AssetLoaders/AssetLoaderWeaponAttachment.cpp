@@ -54,7 +54,7 @@ namespace T6
     class InfoStringToWeaponAttachmentConverter final : public InfoStringToStructConverter
     {
     protected:
-        bool ConvertExtensionField(const cspField_t& field, const std::string& value) override
+        bool ConvertExtensionField(const cspField_t& field, const std::string_view& value) override
         {
             switch (static_cast<attachmentFieldType_t>(field.iFieldType))
             {
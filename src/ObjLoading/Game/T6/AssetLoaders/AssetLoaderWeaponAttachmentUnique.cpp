@@ -18,7 +18,7 @@ namespace T6
 {
     class InfoStringToWeaponAttachmentUniqueConverter final : public InfoStringToStructConverter
     {
-        bool ConvertHideTags(const cspField_t& field, const std::string& value)
+        bool ConvertHideTags(const cspField_t& field, const std::string_view& value)
         {
             std::vector<std::string> valueArray;
             if (!ParseAsArray(value, valueArray))
@@ -56,7 +56,7 @@ namespace T6
             return true;
         }
 
-        _NODISCARD bool ConvertWeaponCamo(const cspField_t& field, const std::string& value)
+        _NODISCARD bool ConvertWeaponCamo(const cspField_t& field, const std::string_view& value)
         {
             if (value.empty())
             {
@@ -64,7 +64,7 @@ namespace T6
                 return true;
             }
 
-            auto* camo = m_loading_manager->LoadDependency(ASSET_TYPE_WEAPON_CAMO, value);
+            auto* camo = m_loading_manager->LoadDependency(ASSET_TYPE_WEAPON_CAMO, std::string(value));
 
             if (camo == nullptr)
             {
@@ -79,7 +79,7 @@ namespace T6
         }
 
     protected:
-        bool ConvertExtensionField(const cspField_t& field, const std::string& value) override
+        bool ConvertExtensionField(const cspField_t& field, const std::string_view& value) override
         {
             switch (static_cast<attachmentUniqueFieldType_t>(field.iFieldType))
             {
@@ -17,7 +17,7 @@ namespace T6
     class InfoStringToZBarrierConverter final : public InfoStringToStructConverter
     {
     protected:
-        bool ConvertExtensionField(const cspField_t& field, const std::string& value) override
+        bool ConvertExtensionField(const cspField_t& field, const std::string_view& value) override
         {
             assert(false);
             return false;
@@ -1,6 +1,7 @@
 #include "InfoStringToStructConverter.h"
 
 #include <cassert>
+#include <charconv>
 #include <iostream>
 
 #include "Game/T6/CommonT6.h"
@@ -16,20 +17,27 @@ InfoStringToStructConverter::InfoStringToStructConverter(const InfoString& infoS
 {
 }
 
-bool InfoStringToStructConverter::GetHashValue(const std::string& value, unsigned& hash)
+bool InfoStringToStructConverter::GetHashValue(const std::string_view& value, unsigned& hash)
 {
     if (!value.empty() && value[0] == '@')
     {
+        const auto* end = value.data() + value.size();
+        const auto [ptr, ec] = std::from_chars(value.data() + 1, end, hash, 16);
+        if (ec == std::errc() && ptr == end)
+            return true;
+
+        // Fall back to strtoul for everything from_chars does not accept like a 0x prefix
+        const std::string hashString(value.substr(1));
         char* endPtr;
-        hash = strtoul(&value[1], &endPtr, 16);
-        return endPtr == &value[value.size()];
+        hash = strtoul(hashString.c_str(), &endPtr, 16);
+        return endPtr == &hashString[hashString.size()];
     }
 
-    hash = Common::Com_HashString(value.c_str());
+    hash = value.empty() ? Common::Com_HashString("") : Common::Com_HashString(value.data(), static_cast<int>(value.size()));
     return true;
 }
 
-bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, const std::string& value)
+bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, const std::string_view& value)
 {
     switch (static_cast<csParseFieldType_t>(field.iFieldType))
     {
@@ -71,7 +79,7 @@ bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, cons
                 return true;
             }
 
-            auto* fx = m_loading_manager->LoadDependency(ASSET_TYPE_FX, value);
+            auto* fx = m_loading_manager->LoadDependency(ASSET_TYPE_FX, std::string(value));
 
             if (fx == nullptr)
             {
@@ -93,7 +101,7 @@ bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, cons
                 return true;
             }
 
-            auto* xmodel = m_loading_manager->LoadDependency(ASSET_TYPE_XMODEL, value);
+            auto* xmodel = m_loading_manager->LoadDependency(ASSET_TYPE_XMODEL, std::string(value));
 
             if (xmodel == nullptr)
             {
@@ -116,7 +124,7 @@ bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, cons
                 return true;
             }
 
-            auto* material = m_loading_manager->LoadDependency(ASSET_TYPE_MATERIAL, value);
+            auto* material = m_loading_manager->LoadDependency(ASSET_TYPE_MATERIAL, std::string(value));
 
             if (material == nullptr)
             {
@@ -138,7 +146,7 @@ bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, cons
                 return true;
             }
 
-            auto* physPreset = m_loading_manager->LoadDependency(ASSET_TYPE_PHYSPRESET, value);
+            auto* physPreset = m_loading_manager->LoadDependency(ASSET_TYPE_PHYSPRESET, std::string(value));
 
             if (physPreset == nullptr)
             {
@@ -163,7 +171,7 @@ bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, cons
                 return true;
             }
 
-            auto* tracer = m_loading_manager->LoadDependency(ASSET_TYPE_TRACER, value);
+            auto* tracer = m_loading_manager->LoadDependency(ASSET_TYPE_TRACER, std::string(value));
 
             if (tracer == nullptr)
             {
@@ -199,24 +207,26 @@ bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, cons
 
 bool InfoStringToStructConverter::Convert()
 {
+    std::vector<InfoStringConversionPlan::FieldValue> fieldValues;
+    GetConversionPlan(m_fields, m_field_count).CollectValues(m_info_string, fieldValues);
+
+    // Fields are still converted in field order to keep script string and dependency order stable
     for (auto fieldIndex = 0u; fieldIndex < m_field_count; fieldIndex++)
     {
         const auto& field = m_fields[fieldIndex];
         assert(field.iFieldType >= 0);
 
-        auto foundValue = false;
-        const auto& value = m_info_string.GetValueForKey(std::string(field.szName), &foundValue);
-
-        if (foundValue)
+        const auto& fieldValue = fieldValues[fieldIndex];
+        if (fieldValue.m_found)
         {
             if (field.iFieldType < CSPFT_NUM_BASE_FIELD_TYPES)
             {
-                if (!ConvertBaseField(field, value))
+                if (!ConvertBaseField(field, fieldValue.m_value))
                     return false;
             }
             else
             {
-                if (!ConvertExtensionField(field, value))
+                if (!ConvertExtensionField(field, fieldValue.m_value))
                     return false;
             }
         }
@@ -12,10 +12,10 @@ namespace T6
         const cspField_t* m_fields;
         size_t m_field_count;
 
-        static bool GetHashValue(const std::string& value, unsigned int& hash);
+        static bool GetHashValue(const std::string_view& value, unsigned int& hash);
 
-        virtual bool ConvertExtensionField(const cspField_t& field, const std::string& value) = 0;
-        bool ConvertBaseField(const cspField_t& field, const std::string& value);
+        virtual bool ConvertExtensionField(const cspField_t& field, const std::string_view& value) = 0;
+        bool ConvertBaseField(const cspField_t& field, const std::string_view& value);
 
     public:
         InfoStringToStructConverter(const InfoString& infoString, void* structure, ZoneScriptStrings& zoneScriptStrings, MemoryManager* memory, IAssetLoadingManager* manager, const cspField_t* fields,
@@ -456,9 +456,16 @@ namespace T6
         return assetLoadingManager.LoadAssetFromLoader(assetType, assetName);
     }
 
-    void ObjLoader::FinalizeAssetsForZone(AssetLoadingContext* context) const
+    bool ObjLoader::FinalizeAssetsForZone(AssetLoadingContext* context) const
     {
+        // All loaders have to be finalized even when one of them failed
+        auto result = true;
         for (const auto& [type, loader] : m_asset_loaders_by_type)
-            loader->FinalizeAssetsForZone(context);
+        {
+            if (!loader->FinalizeAssetsForZone(context))
+                result = false;
+        }
+
+        return result;
     }
 }
@@ -0,0 +1,35 @@
+#include "InfoStringConversionPlan.h"
+
+void InfoStringConversionPlan::AddField(const size_t fieldIndex, const std::string_view key)
+{
+    const auto existingField = m_first_field_for_key.find(key);
+
+    if (existingField != m_first_field_for_key.end())
+    {
+        m_next_field_with_same_key[fieldIndex] = existingField->second;
+        existingField->second = fieldIndex;
+    }
+    else
+        m_first_field_for_key.emplace(key, fieldIndex);
+}
+
+void InfoStringConversionPlan::CollectValues(const InfoString& infoString, std::vector<FieldValue>& fieldValues) const
+{
+    fieldValues.assign(m_next_field_with_same_key.size(), FieldValue{std::string_view(), false});
+
+    const auto entryCount = infoString.GetEntryCount();
+    for (auto entryIndex = 0u; entryIndex < entryCount; entryIndex++)
+    {
+        const auto field = m_first_field_for_key.find(infoString.GetKeyAt(entryIndex));
+        if (field == m_first_field_for_key.end())
+            continue;
+
+        const auto value = infoString.GetValueAt(entryIndex);
+        for (auto fieldIndex = field->second; fieldIndex != NO_FIELD; fieldIndex = m_next_field_with_same_key[fieldIndex])
+        {
+            auto& fieldValue = fieldValues[fieldIndex];
+            fieldValue.m_value = value;
+            fieldValue.m_found = true;
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "InfoString/InfoString.h"
+
+/**
+ * \brief A lookup table from InfoString keys to the fields of a cspField_t array.
+ * It is compiled once per converter type and lets converters collect all field values with a single pass over an InfoString.
+ */
+class InfoStringConversionPlan
+{
+public:
+    class FieldValue
+    {
+    public:
+        std::string_view m_value;
+        bool m_found;
+    };
+
+private:
+    static constexpr size_t NO_FIELD = static_cast<size_t>(-1);
+
+    std::unordered_map<std::string_view, size_t> m_first_field_for_key;
+
+    // Field arrays may contain the same key more than once, every one of them receives the value
+    std::vector<size_t> m_next_field_with_same_key;
+
+    void AddField(size_t fieldIndex, std::string_view key);
+
+public:
+    template <typename TField>
+    InfoStringConversionPlan(const TField* fields, const size_t fieldCount)
+        : m_next_field_with_same_key(fieldCount, NO_FIELD)
+    {
+        m_first_field_for_key.reserve(fieldCount);
+
+        // Add fields in reverse to have every chain of same keys in field order
+        for (auto fieldIndex = fieldCount; fieldIndex > 0u; fieldIndex--)
+            AddField(fieldIndex - 1u, fields[fieldIndex - 1u].szName);
+    }
+
+    /**
+     * \brief Walks the entries of an InfoString once and stores the value of each field by its field index.
+     * The views point into the InfoString and stay valid as long as it is not modified.
+     */
+    void CollectValues(const InfoString& infoString, std::vector<FieldValue>& fieldValues) const;
+};
@@ -1,7 +1,11 @@
 #include "InfoStringToStructConverterBase.h"
 
+#include <algorithm>
+#include <charconv>
 #include <cstring>
 #include <iostream>
+#include <map>
+#include <mutex>
 
 InfoStringToStructConverterBase::InfoStringToStructConverterBase(const InfoString& infoString, void* structure, ZoneScriptStrings& zoneScriptStrings, MemoryManager* memory)
     : m_info_string(infoString),
@@ -11,7 +15,75 @@ InfoStringToStructConverterBase::InfoStringToStructConverterBase(const InfoStrin
 {
 }
 
-bool InfoStringToStructConverterBase::ParseAsArray(const std::string& value, std::vector<std::string>& valueArray)
+const InfoStringConversionPlan& InfoStringToStructConverterBase::GetCachedConversionPlan(const void* fields, const size_t fieldCount,
+                                                                                        const std::function<std::unique_ptr<InfoStringConversionPlan>()>& createPlan)
+{
+    // Converters of different zones may run at the same time
+    static std::mutex plansMutex;
+    static std::map<std::pair<const void*, size_t>, std::unique_ptr<InfoStringConversionPlan>> plans;
+
+    std::lock_guard lock(plansMutex);
+
+    auto& plan = plans[std::make_pair(fields, fieldCount)];
+    if (!plan)
+        plan = createPlan();
+
+    return *plan;
+}
+
+namespace
+{
+    bool IsPlainDecimal(const std::string_view& value)
+    {
+        // strtol with base 0 treats a leading zero as octal prefix, these values are left to it
+        const auto digitsStart = !value.empty() && value[0] == '-' ? 1u : 0u;
+        return value.size() > digitsStart && (value[digitsStart] != '0' || value.size() == digitsStart + 1u);
+    }
+
+    template <typename T>
+    bool FromChars(const std::string_view& value, T& result)
+    {
+        const auto* end = value.data() + value.size();
+        const auto [ptr, ec] = std::from_chars(value.data(), end, result);
+        return ec == std::errc() && ptr == end;
+    }
+}
+
+bool InfoStringToStructConverterBase::ParseLong(const std::string_view& value, long& result)
+{
+    if (IsPlainDecimal(value) && FromChars(value, result))
+        return true;
+
+    // Fall back to strtol for everything from_chars does not accept to keep hex, octal and sign prefixes working
+    const std::string valueString(value);
+    char* endPtr;
+    result = strtol(valueString.c_str(), &endPtr, 0);
+    return endPtr == &valueString[valueString.size()];
+}
+
+bool InfoStringToStructConverterBase::ParseUnsignedLong(const std::string_view& value, unsigned long& result)
+{
+    if (IsPlainDecimal(value) && FromChars(value, result))
+        return true;
+
+    const std::string valueString(value);
+    char* endPtr;
+    result = strtoul(valueString.c_str(), &endPtr, 0);
+    return endPtr == &valueString[valueString.size()];
+}
+
+bool InfoStringToStructConverterBase::ParseFloat(const std::string_view& value, float& result)
+{
+    if (FromChars(value, result))
+        return true;
+
+    const std::string valueString(value);
+    char* endPtr;
+    result = strtof(valueString.c_str(), &endPtr);
+    return endPtr == &valueString[valueString.size()];
+}
+
+bool InfoStringToStructConverterBase::ParseAsArray(const std::string_view& value, std::vector<std::string>& valueArray)
 {
     auto startPos = 0u;
     for (auto ci = 0u; ci < value.size(); ci++)
@@ -20,25 +92,25 @@ bool InfoStringToStructConverterBase::ParseAsArray(const std::string& value, std
 
         if (c == '\r' && ci + 1 < value.size() && value[ci + 1] == '\n')
         {
-            valueArray.emplace_back(value, startPos, ci - startPos);
+            valueArray.emplace_back(value.substr(startPos, ci - startPos));
             startPos = ++ci + 1;
         }
         else if(c == '\n')
         {
-            valueArray.emplace_back(value, startPos, ci - startPos);
+            valueArray.emplace_back(value.substr(startPos, ci - startPos));
             startPos = ci + 1;
         }
     }
 
     if(startPos < value.size())
     {
-        valueArray.emplace_back(value, startPos, value.size() - startPos);
+        valueArray.emplace_back(value.substr(startPos));
     }
 
     return true;
 }
 
-bool InfoStringToStructConverterBase::ParseAsPairs(const std::string& value, std::vector<std::pair<std::string, std::string>>& valueArray) const
+bool InfoStringToStructConverterBase::ParseAsPairs(const std::string_view& value, std::vector<std::pair<std::string, std::string>>& valueArray) const
 {
     std::string key;
     auto isKey = true;
@@ -86,11 +158,11 @@ bool InfoStringToStructConverterBase::ParseAsPairs(const std::string& value, std
                 std::cout << "Expected value but got new line" << std::endl;
                 return false;
             }
-            key = std::string(value, startPos, ci - startPos);
+            key = std::string(value.substr(startPos, ci - startPos));
         }
         else
         {
-            auto parsedValue = std::string(value, startPos, ci - startPos);
+            auto parsedValue = std::string(value.substr(startPos, ci - startPos));
             valueArray.emplace_back(std::make_pair(std::move(key), std::move(parsedValue)));
             key = std::string();
         }
@@ -100,24 +172,33 @@ bool InfoStringToStructConverterBase::ParseAsPairs(const std::string& value, std
     return true;
 }
 
-bool InfoStringToStructConverterBase::ConvertString(const std::string& value, const size_t offset)
+bool InfoStringToStructConverterBase::ConvertString(const std::string_view& value, const size_t offset)
 {
-    *reinterpret_cast<const char**>(reinterpret_cast<uintptr_t>(m_structure) + offset) = m_memory->Dup(value.c_str());
+    auto* str = static_cast<char*>(m_memory->Alloc(value.size() + 1u));
+    memcpy(str, value.data(), value.size());
+    str[value.size()] = '\0';
+
+    *reinterpret_cast<const char**>(reinterpret_cast<uintptr_t>(m_structure) + offset) = str;
     return true;
 }
 
-bool InfoStringToStructConverterBase::ConvertStringBuffer(const std::string& value, const size_t offset, const size_t bufferSize)
+bool InfoStringToStructConverterBase::ConvertStringBuffer(const std::string_view& value, const size_t offset, const size_t bufferSize)
 {
-    strncpy(reinterpret_cast<char*>(reinterpret_cast<uintptr_t>(m_structure) + offset), value.c_str(), bufferSize);
+    // Same as strncpy: The buffer is padded with zeros and not terminated when the value fills it completely
+    auto* buffer = reinterpret_cast<char*>(reinterpret_cast<uintptr_t>(m_structure) + offset);
+    const auto copySize = std::min(value.size(), bufferSize);
+    memcpy(buffer, value.data(), copySize);
+    memset(&buffer[copySize], 0, bufferSize - copySize);
     return true;
 }
 
-bool InfoStringToStructConverterBase::ConvertInt(const std::string& value, const size_t offset)
+bool InfoStringToStructConverterBase::ConvertInt(const std::string_view& value, const size_t offset)
 {
-    char* endPtr;
-    *reinterpret_cast<int*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = strtol(value.c_str(), &endPtr, 0);
+    long intValue;
+    const auto success = ParseLong(value, intValue);
 
-    if(endPtr != &value[value.size()])
+    *reinterpret_cast<int*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = static_cast<int>(intValue);
+    if (!success)
     {
         std::cout << "Failed to parse value \"" << value << "\" as int" << std::endl;
         return false;
@@ -126,12 +207,13 @@ bool InfoStringToStructConverterBase::ConvertInt(const std::string& value, const
     return true;
 }
 
-bool InfoStringToStructConverterBase::ConvertUint(const std::string& value, const size_t offset)
+bool InfoStringToStructConverterBase::ConvertUint(const std::string_view& value, const size_t offset)
 {
-    char* endPtr;
-    *reinterpret_cast<unsigned int*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = strtoul(value.c_str(), &endPtr, 0);
+    unsigned long uintValue;
+    const auto success = ParseUnsignedLong(value, uintValue);
 
-    if (endPtr != &value[value.size()])
+    *reinterpret_cast<unsigned int*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = static_cast<unsigned int>(uintValue);
+    if (!success)
     {
         std::cout << "Failed to parse value \"" << value << "\" as uint" << std::endl;
         return false;
@@ -140,13 +222,13 @@ bool InfoStringToStructConverterBase::ConvertUint(const std::string& value, cons
     return true;
 }
 
-bool InfoStringToStructConverterBase::ConvertBool(const std::string& value, const size_t offset)
+bool InfoStringToStructConverterBase::ConvertBool(const std::string_view& value, const size_t offset)
 {
-    char* endPtr;
-    const auto intValue = strtol(value.c_str(), &endPtr, 0);
+    long intValue;
+    const auto success = ParseLong(value, intValue);
 
     *reinterpret_cast<bool*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = intValue != 0;
-    if (endPtr != &value[value.size()])
+    if (!success)
     {
         std::cout << "Failed to parse value \"" << value << "\" as bool" << std::endl;
         return false;
@@ -155,13 +237,13 @@ bool InfoStringToStructConverterBase::ConvertBool(const std::string& value, cons
     return true;
 }
 
-bool InfoStringToStructConverterBase::ConvertQBoolean(const std::string& value, const size_t offset)
+bool InfoStringToStructConverterBase::ConvertQBoolean(const std::string_view& value, const size_t offset)
 {
-    char* endPtr;
-    const auto intValue = strtol(value.c_str(), &endPtr, 0);
+    long intValue;
+    const auto success = ParseLong(value, intValue);
 
     *reinterpret_cast<int*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = intValue != 0 ? 1 : 0;
-    if (endPtr != &value[value.size()])
+    if (!success)
     {
         std::cout << "Failed to parse value \"" << value << "\" as qboolean" << std::endl;
         return false;
@@ -170,12 +252,13 @@ bool InfoStringToStructConverterBase::ConvertQBoolean(const std::string& value,
     return true;
 }
 
-bool InfoStringToStructConverterBase::ConvertFloat(const std::string& value, const size_t offset)
+bool InfoStringToStructConverterBase::ConvertFloat(const std::string_view& value, const size_t offset)
 {
-    char* endPtr;
-    *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = strtof(value.c_str(), &endPtr);
+    float floatValue;
+    const auto success = ParseFloat(value, floatValue);
 
-    if (endPtr != &value[value.size()])
+    *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = floatValue;
+    if (!success)
     {
         std::cout << "Failed to parse value \"" << value << "\" as float" << std::endl;
         return false;
@@ -184,12 +267,13 @@ bool InfoStringToStructConverterBase::ConvertFloat(const std::string& value, con
     return true;
 }
 
-bool InfoStringToStructConverterBase::ConvertMilliseconds(const std::string& value, const size_t offset)
+bool InfoStringToStructConverterBase::ConvertMilliseconds(const std::string_view& value, const size_t offset)
 {
-    char* endPtr;
-    *reinterpret_cast<unsigned int*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = static_cast<unsigned int>(strtof(value.c_str(), &endPtr) * 1000.0f);
+    float floatValue;
+    const auto success = ParseFloat(value, floatValue);
 
-    if (endPtr != &value[value.size()])
+    *reinterpret_cast<unsigned int*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = static_cast<unsigned int>(floatValue * 1000.0f);
+    if (!success)
     {
         std::cout << "Failed to parse value \"" << value << "\" as milliseconds" << std::endl;
         return false;
@@ -198,16 +282,16 @@ bool InfoStringToStructConverterBase::ConvertMilliseconds(const std::string& val
     return true;
 }
 
-bool InfoStringToStructConverterBase::ConvertScriptString(const std::string& value, const size_t offset)
+bool InfoStringToStructConverterBase::ConvertScriptString(const std::string_view& value, const size_t offset)
 {
-    auto scrStrValue = m_zone_script_strings.AddOrGetScriptString(value);
+    auto scrStrValue = m_zone_script_strings.AddOrGetScriptString(std::string(value));
     m_used_script_string_list.emplace(scrStrValue);
     *reinterpret_cast<scr_string_t*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = scrStrValue;
 
     return true;
 }
 
-bool InfoStringToStructConverterBase::ConvertEnumInt(const std::string& value, const size_t offset, const char** enumValues, const size_t enumSize)
+bool InfoStringToStructConverterBase::ConvertEnumInt(const std::string_view& value, const size_t offset, const char** enumValues, const size_t enumSize)
 {
     for(auto i = 0u; i < enumSize; i++)
     {
@@ -1,17 +1,24 @@
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <utility>
 
 #include "Utils/ClassUtils.h"
 #include "InfoString/InfoString.h"
+#include "InfoString/InfoStringConversionPlan.h"
 #include "Pool/XAssetInfo.h"
 #include "Utils/MemoryManager.h"
 #include "Zone/ZoneScriptStrings.h"
 
 class InfoStringToStructConverterBase
 {
+    _NODISCARD static const InfoStringConversionPlan& GetCachedConversionPlan(const void* fields, size_t fieldCount,
+                                                                               const std::function<std::unique_ptr<InfoStringConversionPlan>()>& createPlan);
+
 protected:
     const InfoString& m_info_string;
     ZoneScriptStrings& m_zone_script_strings;
@@ -20,19 +27,35 @@ protected:
     MemoryManager* m_memory;
     void* m_structure;
 
-    static bool ParseAsArray(const std::string& value, std::vector<std::string>& valueArray);
-    bool ParseAsPairs(const std::string& value, std::vector<std::pair<std::string, std::string>>& valueArray) const;
+    /**
+     * \brief Returns the conversion plan for a field array. The plan is only built once for every field array and shared by all converters that use it.
+     */
+    template <typename TField>
+    _NODISCARD static const InfoStringConversionPlan& GetConversionPlan(const TField* fields, const size_t fieldCount)
+    {
+        return GetCachedConversionPlan(fields, fieldCount, [fields, fieldCount]
+        {
+            return std::make_unique<InfoStringConversionPlan>(fields, fieldCount);
+        });
+    }
+
+    static bool ParseLong(const std::string_view& value, long& result);
+    static bool ParseUnsignedLong(const std::string_view& value, unsigned long& result);
+    static bool ParseFloat(const std::string_view& value, float& result);
+
+    static bool ParseAsArray(const std::string_view& value, std::vector<std::string>& valueArray);
+    bool ParseAsPairs(const std::string_view& value, std::vector<std::pair<std::string, std::string>>& valueArray) const;
     
-    bool ConvertString(const std::string& value, size_t offset);
-    bool ConvertStringBuffer(const std::string& value, size_t offset, size_t bufferSize);
-    bool ConvertInt(const std::string& value, size_t offset);
-    bool ConvertUint(const std::string& value, size_t offset);
-    bool ConvertBool(const std::string& value, size_t offset);
-    bool ConvertQBoolean(const std::string& value, size_t offset);
-    bool ConvertFloat(const std::string& value, size_t offset);
-    bool ConvertMilliseconds(const std::string& value, size_t offset);
-    bool ConvertScriptString(const std::string& value, size_t offset);
-    bool ConvertEnumInt(const std::string& value, size_t offset, const char** enumValues, size_t enumSize);
+    bool ConvertString(const std::string_view& value, size_t offset);
+    bool ConvertStringBuffer(const std::string_view& value, size_t offset, size_t bufferSize);
+    bool ConvertInt(const std::string_view& value, size_t offset);
+    bool ConvertUint(const std::string_view& value, size_t offset);
+    bool ConvertBool(const std::string_view& value, size_t offset);
+    bool ConvertQBoolean(const std::string_view& value, size_t offset);
+    bool ConvertFloat(const std::string_view& value, size_t offset);
+    bool ConvertMilliseconds(const std::string_view& value, size_t offset);
+    bool ConvertScriptString(const std::string_view& value, size_t offset);
+    bool ConvertEnumInt(const std::string_view& value, size_t offset, const char** enumValues, size_t enumSize);
 
 public:
     InfoStringToStructConverterBase(const InfoString& infoString, void* structure, ZoneScriptStrings& zoneScriptStrings, MemoryManager* memory);
@@ -85,6 +85,22 @@ public:
         }
     }
 
+    /**
+     * \brief Gets all containers a referencer references in the order they were added.
+     */
+    std::vector<ContainerType*> GetContainersReferencedBy(ReferencerType* referencer)
+    {
+        std::vector<ContainerType*> result;
+
+        for (const auto& entry : m_containers)
+        {
+            if (entry.m_references.find(referencer) != entry.m_references.end())
+                result.push_back(entry.m_container.get());
+        }
+
+        return result;
+    }
+
     ContainerType* GetContainerByName(const std::string& name)
     {
         auto foundEntry = std::find_if(m_containers.begin(), m_containers.end(), [name](ObjContainerEntry& entry)
@@ -107,14 +107,15 @@ bool ObjLoading::LoadAssetForZone(AssetLoadingContext* context, const asset_type
     return false;
 }
 
-void ObjLoading::FinalizeAssetsForZone(AssetLoadingContext* context)
+bool ObjLoading::FinalizeAssetsForZone(AssetLoadingContext* context)
 {
     for (const auto* loader : OBJ_LOADERS)
     {
         if (loader->SupportsZone(context->m_zone))
         {
-            loader->FinalizeAssetsForZone(context);
-            return;
+            return loader->FinalizeAssetsForZone(context);
         }
     }
+
+    return false;
 }
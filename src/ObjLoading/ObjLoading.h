@@ -14,6 +14,11 @@ public:
         bool Verbose = false;
         bool MenuPermissiveParsing = false;
         bool MenuNoOptimization = false;
+
+        // 0 uses one thread per hardware thread
+        unsigned AssetLoadingThreadCount = 0;
+        // Maximum amount of bytes of asset data that is processed by asset loading tasks at the same time
+        size_t AssetLoadingTaskDataBudget = 256u * 1024u * 1024u;
     } Configuration;
 
     /**
@@ -55,5 +60,11 @@ public:
     static void LoadObjDataForZone(ISearchPath* searchPath, Zone* zone);
 
     static bool LoadAssetForZone(AssetLoadingContext* context, asset_type_t assetType, const std::string& assetName);
-    static void FinalizeAssetsForZone(AssetLoadingContext* context);
+
+    /**
+     * \brief Finalizes all assets that were loaded for a zone. Must be called after all assets of the zone were loaded.
+     * \param context The context the assets of the zone were loaded with.
+     * \return \c true if all assets could be finalized, \c false if the zone must not be used.
+     */
+    static bool FinalizeAssetsForZone(AssetLoadingContext* context);
 };
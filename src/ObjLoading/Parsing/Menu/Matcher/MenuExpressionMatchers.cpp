@@ -50,27 +50,28 @@ const std::map<std::string, size_t>& MenuExpressionMatchers::GetBaseFunctionMapF
 {
     if(featureLevel == FeatureLevel::IW4)
     {
-        static std::map<std::string, size_t> iw4FunctionMap;
-        static bool iw4FunctionMapInitialized = false;
-
-        if(!iw4FunctionMapInitialized)
+        // Initialized only once in a thread safe manner since menus can be parsed concurrently
+        static const std::map<std::string, size_t> iw4FunctionMap = []
         {
+            std::map<std::string, size_t> functionMap;
             for(size_t i = IW4::expressionFunction_e::EXP_FUNC_DYN_START; i < std::extent_v<decltype(IW4::g_expFunctionNames)>; i++)
-                iw4FunctionMap.emplace(std::make_pair(IW4::g_expFunctionNames[i], i));
-        }
+                functionMap.emplace(std::make_pair(IW4::g_expFunctionNames[i], i));
+
+            return functionMap;
+        }();
 
         return iw4FunctionMap;
     }
     if(featureLevel == FeatureLevel::IW5)
     {
-        static std::map<std::string, size_t> iw5FunctionMap;
-        static bool iw5FunctionMapInitialized = false;
-
-        if(!iw5FunctionMapInitialized)
+        static const std::map<std::string, size_t> iw5FunctionMap = []
         {
+            std::map<std::string, size_t> functionMap;
             for(size_t i = IW5::expressionFunction_e::EXP_FUNC_DYN_START; i < std::extent_v<decltype(IW5::g_expFunctionNames)>; i++)
-                iw5FunctionMap.emplace(std::make_pair(IW5::g_expFunctionNames[i], i));
-        }
+                functionMap.emplace(std::make_pair(IW5::g_expFunctionNames[i], i));
+
+            return functionMap;
+        }();
 
         return iw5FunctionMap;
     }
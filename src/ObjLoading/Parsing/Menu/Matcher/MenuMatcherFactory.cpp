@@ -91,7 +91,7 @@ double MenuMatcherFactory::TokenNumericFloatingPointValue(const SimpleParserValu
     return value.FloatingPointValue();
 }
 
-std::string& MenuMatcherFactory::TokenTextValue(const SimpleParserValue& value)
+const std::string& MenuMatcherFactory::TokenTextValue(const SimpleParserValue& value)
 {
     if (value.m_type == SimpleParserValueType::IDENTIFIER)
     {
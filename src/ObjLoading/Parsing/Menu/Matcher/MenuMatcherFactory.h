@@ -29,7 +29,7 @@ namespace menu
 
         _NODISCARD static int TokenNumericIntValue(const SimpleParserValue& value);
         _NODISCARD static double TokenNumericFloatingPointValue(const SimpleParserValue& value);
-        _NODISCARD static std::string& TokenTextValue(const SimpleParserValue& value);
+        _NODISCARD static const std::string& TokenTextValue(const SimpleParserValue& value);
 
         _NODISCARD static int TokenIntExpressionValue(MenuFileParserState* state, SequenceResult<SimpleParserValue>& result);
         _NODISCARD static double TokenNumericExpressionValue(MenuFileParserState* state, SequenceResult<SimpleParserValue>& result);
@@ -5,6 +5,7 @@
 #include "AssetLoading/IZoneAssetLoaderState.h"
 #include "Domain/CommonFunctionDef.h"
 #include "Domain/CommonMenuDef.h"
+#include "MenuIncludeFileCache.h"
 
 namespace menu
 {
@@ -18,6 +19,8 @@ namespace menu
 
         std::map<std::string, std::vector<std::string>> m_menus_to_load_by_menu;
 
+        MenuIncludeFileCache m_include_file_cache;
+
         MenuAssetZoneState() = default;
         
         void AddFunction(std::unique_ptr<CommonFunctionDef> function);
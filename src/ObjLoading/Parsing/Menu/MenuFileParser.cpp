@@ -6,6 +6,7 @@
 #include "Sequence/ItemScopeSequences.h"
 #include "Sequence/MenuScopeSequences.h"
 #include "Sequence/NoScopeSequences.h"
+#include "Parsing/Simple/Matcher/SimpleMatcherFirstTokens.h"
 
 using namespace menu;
 
@@ -79,6 +80,13 @@ const std::vector<MenuFileParser::sequence_t*>& MenuFileParser::GetTestsForState
     return m_no_scope_tests;
 }
 
+bool MenuFileParser::GetFirstTokenKey(const SimpleParserValue& token, int& type, size_t& value) const
+{
+    // Scopes have hundreds of property sequences so only try the ones that can start with the next token
+    SimpleMatcherFirstTokens::GetTokenKey(token, type, value);
+    return true;
+}
+
 MenuFileParserState* MenuFileParser::GetState() const
 {
     return m_state.get();
@@ -24,6 +24,7 @@ namespace menu
 
     protected:
         const std::vector<sequence_t*>& GetTestsForState() override;
+        bool GetFirstTokenKey(const SimpleParserValue& token, int& type, size_t& value) const override;
 
     public:
         MenuFileParser(SimpleLexer* lexer, FeatureLevel featureLevel, bool permissiveMode);
@@ -4,6 +4,7 @@
 #include "Matcher/MenuExpressionMatchers.h"
 #include "Parsing/Impl/CommentRemovingStreamProxy.h"
 #include "Parsing/Impl/DefinesStreamProxy.h"
+#include "Parsing/Impl/IncludeCachingStreamProxy.h"
 #include "Parsing/Impl/IncludingStreamProxy.h"
 #include "Parsing/Impl/ParserMultiInputStream.h"
 #include "Parsing/Impl/ParserSingleInputStream.h"
@@ -15,6 +16,20 @@ MenuFileReader::MenuFileReader(std::istream& stream, std::string fileName, const
     : m_feature_level(featureLevel),
       m_file_name(std::move(fileName)),
       m_stream(nullptr),
+      m_include_cache(nullptr),
+      m_zone_state(nullptr),
+      m_permissive_mode(false)
+{
+    OpenBaseStream(stream, std::move(includeCallback));
+    SetupStreamProxies();
+    m_stream = m_open_streams.back().get();
+}
+
+MenuFileReader::MenuFileReader(std::istream& stream, std::string fileName, const FeatureLevel featureLevel, include_callback_t includeCallback, PreprocessedIncludeCache* includeCache)
+    : m_feature_level(featureLevel),
+      m_file_name(std::move(fileName)),
+      m_stream(nullptr),
+      m_include_cache(includeCache),
       m_zone_state(nullptr),
       m_permissive_mode(false)
 {
@@ -27,6 +42,7 @@ MenuFileReader::MenuFileReader(std::istream& stream, std::string fileName, const
     : m_feature_level(featureLevel),
       m_file_name(std::move(fileName)),
       m_stream(nullptr),
+      m_include_cache(nullptr),
       m_zone_state(nullptr),
       m_permissive_mode(false)
 {
@@ -45,9 +61,10 @@ bool MenuFileReader::OpenBaseStream(std::istream& stream, include_callback_t inc
     return true;
 }
 
-void MenuFileReader::SetupDefinesProxy()
+DefinesStreamProxy* MenuFileReader::SetupDefinesProxy()
 {
     auto defines = std::make_unique<DefinesStreamProxy>(m_open_streams.back().get());
+    auto* definesPtr = defines.get();
 
     defines->AddDefine(DefinesStreamProxy::Define("PC", "1"));
     switch (m_feature_level)
@@ -64,13 +81,27 @@ void MenuFileReader::SetupDefinesProxy()
     }
 
     m_open_streams.emplace_back(std::move(defines));
+
+    return definesPtr;
 }
 
 void MenuFileReader::SetupStreamProxies()
 {
     m_open_streams.emplace_back(std::make_unique<CommentRemovingStreamProxy>(m_open_streams.back().get()));
+
+    IncludeCachingStreamProxy* includeCaching = nullptr;
+    if (m_include_cache)
+    {
+        auto includeCachingProxy = std::make_unique<IncludeCachingStreamProxy>(m_open_streams.back().get(), m_include_cache);
+        includeCaching = includeCachingProxy.get();
+        m_open_streams.emplace_back(std::move(includeCachingProxy));
+    }
+
     m_open_streams.emplace_back(std::make_unique<IncludingStreamProxy>(m_open_streams.back().get()));
-    SetupDefinesProxy();
+    auto* defines = SetupDefinesProxy();
+
+    if (includeCaching)
+        includeCaching->SetDefinesProxy(defines);
 
     m_stream = m_open_streams.back().get();
 }
@@ -132,6 +163,7 @@ std::unique_ptr<ParsingResult> MenuFileReader::ReadMenuFile()
     lexerConfig.m_string_escape_sequences = true;
     lexerConfig.m_read_integer_numbers = true;
     lexerConfig.m_read_floating_point_numbers = true;
+    lexerConfig.m_read_whole_input = true;
     MenuExpressionMatchers().ApplyTokensToLexerConfig(lexerConfig);
 
     const auto lexer = std::make_unique<SimpleLexer>(m_stream, std::move(lexerConfig));
@@ -8,6 +8,8 @@
 #include "Domain/MenuFeatureLevel.h"
 #include "Domain/MenuParsingResult.h"
 #include "Parsing/IParserLineStream.h"
+#include "Parsing/Impl/DefinesStreamProxy.h"
+#include "Parsing/Impl/PreprocessedIncludeCache.h"
 #include "MenuAssetZoneState.h"
 
 namespace menu
@@ -23,12 +25,13 @@ namespace menu
 
         IParserLineStream* m_stream;
         std::vector<std::unique_ptr<IParserLineStream>> m_open_streams;
+        PreprocessedIncludeCache* m_include_cache;
 
         const MenuAssetZoneState* m_zone_state;
         bool m_permissive_mode;
 
         bool OpenBaseStream(std::istream& stream, include_callback_t includeCallback);
-        void SetupDefinesProxy();
+        DefinesStreamProxy* SetupDefinesProxy();
         void SetupStreamProxies();
 
         bool IsValidEndState(const MenuFileParserState* state) const;
@@ -37,6 +40,7 @@ namespace menu
     public:
         MenuFileReader(std::istream& stream, std::string fileName, FeatureLevel featureLevel);
         MenuFileReader(std::istream& stream, std::string fileName, FeatureLevel featureLevel, include_callback_t includeCallback);
+        MenuFileReader(std::istream& stream, std::string fileName, FeatureLevel featureLevel, include_callback_t includeCallback, PreprocessedIncludeCache* includeCache);
 
         void IncludeZoneState(const MenuAssetZoneState* zoneState);
         void SetPermissiveMode(bool usePermissiveMode);
@@ -0,0 +1,63 @@
+#include "MenuIncludeFileCache.h"
+
+#include <sstream>
+#include <streambuf>
+
+using namespace menu;
+
+namespace
+{
+    class CachedFileStreamBuffer final : public std::streambuf
+    {
+    public:
+        explicit CachedFileStreamBuffer(const std::string& contents)
+        {
+            auto* data = const_cast<char*>(contents.data());
+            setg(data, data, data + contents.size());
+        }
+    };
+
+    class CachedFileStream final : public std::istream
+    {
+    public:
+        explicit CachedFileStream(const std::string& contents)
+            : std::istream(nullptr),
+              m_buffer(contents)
+        {
+            rdbuf(&m_buffer);
+        }
+
+    private:
+        CachedFileStreamBuffer m_buffer;
+    };
+}
+
+std::unique_ptr<std::istream> MenuIncludeFileCache::Open(const std::string& filename, ISearchPath* searchPath)
+{
+    auto cachedFile = m_file_contents.find(filename);
+
+    if (cachedFile == m_file_contents.end())
+    {
+        std::unique_ptr<std::string> contents;
+
+        const auto file = searchPath->Open(filename);
+        if (file.IsOpen() && file.m_stream)
+        {
+            std::ostringstream ss;
+            ss << file.m_stream->rdbuf();
+            contents = std::make_unique<std::string>(ss.str());
+        }
+
+        cachedFile = m_file_contents.emplace(std::make_pair(filename, std::move(contents))).first;
+    }
+
+    if (!cachedFile->second)
+        return nullptr;
+
+    return std::make_unique<CachedFileStream>(*cachedFile->second);
+}
+
+PreprocessedIncludeCache& MenuIncludeFileCache::GetPreprocessedIncludes()
+{
+    return m_preprocessed_includes;
+}
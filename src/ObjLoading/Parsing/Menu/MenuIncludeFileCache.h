@@ -0,0 +1,46 @@
+#pragma once
+
+#include <istream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "Parsing/Impl/PreprocessedIncludeCache.h"
+#include "SearchPath/ISearchPath.h"
+
+namespace menu
+{
+    /**
+     * \brief Keeps the contents of files that are included by menu files and the result of preprocessing them.
+     * Menu files of a zone usually all include the same headers, this way they are only looked up in the search path and read once.
+     * Files that could not be found are remembered as well.
+     * As long as a header is included with the same defines it is only preprocessed once as well.
+     */
+    class MenuIncludeFileCache
+    {
+    public:
+        MenuIncludeFileCache() = default;
+        ~MenuIncludeFileCache() = default;
+        MenuIncludeFileCache(const MenuIncludeFileCache& other) = delete;
+        MenuIncludeFileCache(MenuIncludeFileCache&& other) noexcept = default;
+        MenuIncludeFileCache& operator=(const MenuIncludeFileCache& other) = delete;
+        MenuIncludeFileCache& operator=(MenuIncludeFileCache&& other) noexcept = default;
+
+        /**
+         * \brief Opens a file to be included.
+         * \param filename The name of the file in the search path.
+         * \param searchPath The search path to read the file from if it is not cached yet.
+         * \return A stream reading the cached contents of the file or \c nullptr if the file could not be found. It must not outlive the cache.
+         */
+        std::unique_ptr<std::istream> Open(const std::string& filename, ISearchPath* searchPath);
+
+        /**
+         * \brief The preprocessed included files, to be passed to the readers of the menu files.
+         */
+        PreprocessedIncludeCache& GetPreprocessedIncludes();
+
+    private:
+        std::unordered_map<std::string, std::unique_ptr<std::string>> m_file_contents;
+        PreprocessedIncludeCache m_preprocessed_includes;
+    };
+}
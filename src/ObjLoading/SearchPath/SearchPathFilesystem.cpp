@@ -1,5 +1,7 @@
 #include "SearchPathFilesystem.h"
 
+#include <algorithm>
+#include <cctype>
 #include <filesystem>
 #include <fstream>
 
@@ -8,6 +10,8 @@
 namespace fs = std::filesystem;
 
 SearchPathFilesystem::SearchPathFilesystem(std::string path)
+    : m_use_file_index(false),
+      m_file_index_generation(0u)
 {
     m_path = std::move(path);
 }
@@ -17,8 +21,125 @@ std::string SearchPathFilesystem::GetPath()
     return m_path;
 }
 
+void SearchPathFilesystem::SetUseFileIndex(const bool useFileIndex)
+{
+    std::lock_guard<std::mutex> lock(m_file_index_mutex);
+    m_use_file_index = useFileIndex;
+}
+
+void SearchPathFilesystem::InvalidateFileIndex()
+{
+    std::lock_guard<std::mutex> lock(m_file_index_mutex);
+    m_file_index_generation++;
+    m_file_index.reset();
+}
+
+std::string SearchPathFilesystem::GetFileIndexKey(const fs::path& relativePath)
+{
+    auto key = relativePath.lexically_normal().generic_string();
+
+#if defined(_WIN32) || defined(_WIN64) || defined(_MSC_VER)
+    // The filesystem does not care about case on windows so the index should not either
+    for (auto& c : key)
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+#endif
+
+    return key;
+}
+
+std::shared_ptr<const SearchPathFilesystem::FileIndex> SearchPathFilesystem::BuildFileIndex(const std::string& path)
+{
+    auto fileIndex = std::make_shared<FileIndex>();
+    const auto rootLength = fs::path(path).native().size();
+
+    // Symlinks to directories are followed, but every directory is only indexed once to not loop forever on symlink cycles
+    std::error_code ec;
+    std::unordered_set<std::string> indexedDirectories;
+    indexedDirectories.emplace(fs::canonical(path, ec).string());
+
+    fs::recursive_directory_iterator iterator(path, fs::directory_options::follow_directory_symlink | fs::directory_options::skip_permission_denied, ec);
+    for (; !ec && iterator != fs::recursive_directory_iterator(); iterator.increment(ec))
+    {
+        auto relativePath = iterator->path().native().substr(rootLength);
+        const auto firstNonSeparator = relativePath.find_first_not_of(fs::path::preferred_separator);
+        relativePath.erase(0, std::min(firstNonSeparator, relativePath.size()));
+
+        auto key = GetFileIndexKey(relativePath);
+
+        std::error_code directoryEc;
+        if (iterator->is_directory(directoryEc))
+        {
+            const auto canonicalPath = fs::canonical(iterator->path(), directoryEc);
+            if (directoryEc || !indexedDirectories.emplace(canonicalPath.string()).second)
+            {
+                iterator.disable_recursion_pending();
+                fileIndex->m_unindexed_directories.emplace_back(key + '/');
+            }
+        }
+
+        fileIndex->m_files.emplace(std::move(key));
+    }
+
+    // When the directory cannot be listed completely every file is looked up on the filesystem as usual
+    if (ec)
+    {
+        fileIndex->m_files.clear();
+        return fileIndex;
+    }
+
+    fileIndex->m_usable = true;
+    return fileIndex;
+}
+
+std::shared_ptr<const SearchPathFilesystem::FileIndex> SearchPathFilesystem::GetFileIndex()
+{
+    std::unique_lock<std::mutex> lock(m_file_index_mutex);
+    if (!m_use_file_index)
+        return nullptr;
+
+    if (m_file_index)
+        return m_file_index;
+
+    // Listing the directory can take a while, so other threads can keep using the search path in the meantime
+    const auto generation = m_file_index_generation;
+    lock.unlock();
+    auto fileIndex = BuildFileIndex(m_path);
+    lock.lock();
+
+    // The index is only kept when it was not invalidated while it was being built
+    if (m_use_file_index && !m_file_index && m_file_index_generation == generation)
+        m_file_index = fileIndex;
+
+    return fileIndex;
+}
+
+bool SearchPathFilesystem::MayContainFile(const std::string& fileName)
+{
+    const auto relativePath = fs::path(fileName).lexically_normal();
+
+    // Paths that leave the directory of the search path cannot be answered by the index
+    if (relativePath.has_root_path() || (!relativePath.empty() && *relativePath.begin() == ".."))
+        return true;
+
+    const auto fileIndex = GetFileIndex();
+    if (!fileIndex || !fileIndex->m_usable)
+        return true;
+
+    const auto key = GetFileIndexKey(relativePath);
+    for (const auto& unindexedDirectory : fileIndex->m_unindexed_directories)
+    {
+        if (key.compare(0, unindexedDirectory.size(), unindexedDirectory) == 0)
+            return true;
+    }
+
+    return fileIndex->m_files.find(key) != fileIndex->m_files.end();
+}
+
 SearchPathOpenFile SearchPathFilesystem::Open(const std::string& fileName)
 {
+    if (!MayContainFile(fileName))
+        return SearchPathOpenFile();
+
     const auto filePath = fs::path(m_path).append(fileName);
     std::ifstream file(filePath.string(), std::fstream::in | std::fstream::binary);
 
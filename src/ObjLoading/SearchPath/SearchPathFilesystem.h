@@ -1,17 +1,53 @@
 #pragma once
 
+#include <filesystem>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 #include "ISearchPath.h"
 
 class SearchPathFilesystem final : public ISearchPath
 {
+    class FileIndex
+    {
+    public:
+        std::unordered_set<std::string> m_files;
+        // Directories that were reached through a symlink to a directory that was already indexed
+        std::vector<std::string> m_unindexed_directories;
+        bool m_usable = false;
+    };
+
     std::string m_path;
 
+    bool m_use_file_index;
+    unsigned m_file_index_generation;
+    std::shared_ptr<const FileIndex> m_file_index;
+    std::mutex m_file_index_mutex;
+
+    static std::string GetFileIndexKey(const std::filesystem::path& relativePath);
+    static std::shared_ptr<const FileIndex> BuildFileIndex(const std::string& path);
+    std::shared_ptr<const FileIndex> GetFileIndex();
+    bool MayContainFile(const std::string& fileName);
+
 public:
     explicit SearchPathFilesystem(std::string path);
 
     SearchPathOpenFile Open(const std::string& fileName) override;
     std::string GetPath() override;
     void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override;
-};
\ No newline at end of file
+
+    /**
+     * \brief Makes the search path remember all files in its directory, so opening a file that does not exist is answered without asking the filesystem.
+     * The index is built when a file is opened for the first time. Files that are added to the directory afterwards are not found until the index is invalidated.
+     * \param useFileIndex Whether the index should be used.
+     */
+    void SetUseFileIndex(bool useFileIndex);
+
+    /**
+     * \brief Discards the file index, so it is built again the next time a file is opened.
+     */
+    void InvalidateFileIndex();
+};
@@ -4,8 +4,47 @@
 #include <iostream>
 #include <algorithm>
 
+#include "Parsing/Simple/Expression/SimpleExpressionBinaryOperation.h"
+#include "Parsing/Simple/Expression/SimpleExpressionConditionalOperator.h"
+#include "Parsing/Simple/Expression/SimpleExpressionScopeValue.h"
+#include "Parsing/Simple/Expression/SimpleExpressionUnaryOperation.h"
+
 using namespace state_map;
 
+namespace
+{
+    /**
+     * \brief Collects the names of all scope values an expression uses.
+     * \return \c true if all parts of the expression are known, \c false if the expression can use values that cannot be determined.
+     */
+    bool CollectScopeValueNames(const ISimpleExpression* expression, std::vector<std::string>& names)
+    {
+        if (dynamic_cast<const SimpleExpressionValue*>(expression))
+            return true;
+
+        if (const auto* scopeValue = dynamic_cast<const SimpleExpressionScopeValue*>(expression))
+        {
+            names.push_back(scopeValue->m_value_name);
+            return true;
+        }
+
+        if (const auto* unaryOperation = dynamic_cast<const SimpleExpressionUnaryOperation*>(expression))
+            return CollectScopeValueNames(unaryOperation->m_operand.get(), names);
+
+        if (const auto* binaryOperation = dynamic_cast<const SimpleExpressionBinaryOperation*>(expression))
+            return CollectScopeValueNames(binaryOperation->m_operand1.get(), names) && CollectScopeValueNames(binaryOperation->m_operand2.get(), names);
+
+        if (const auto* conditionalOperator = dynamic_cast<const SimpleExpressionConditionalOperator*>(expression))
+        {
+            return CollectScopeValueNames(conditionalOperator->m_condition.get(), names)
+                && CollectScopeValueNames(conditionalOperator->m_true_value.get(), names)
+                && CollectScopeValueNames(conditionalOperator->m_false_value.get(), names);
+        }
+
+        return false;
+    }
+}
+
 void StateMapVars::AddValue(std::string key, std::string value)
 {
     m_vars.emplace(std::make_pair(std::move(key), std::move(value)));
@@ -25,6 +64,94 @@ StateMapHandler::StateMapHandler(const StateMapLayout& stateMapLayout, const Sta
     : m_state_map_layout(stateMapLayout),
       m_state_map(stateMap)
 {
+    CompileStateMap();
+}
+
+void StateMapHandler::CompileStateMap()
+{
+    const auto varCount = m_state_map_layout.m_var_layout.m_vars.size();
+    m_all_var_indices.reserve(varCount);
+    for (auto varIndex = 0u; varIndex < varCount; varIndex++)
+        m_all_var_indices.push_back(varIndex);
+
+    m_compiled_entries.reserve(m_state_map.m_state_map_entries.size());
+    for (const auto& entry : m_state_map.m_state_map_entries)
+    {
+        CompiledEntry compiledEntry;
+        compiledEntry.m_default_rule = entry.m_rules[entry.m_default_index].get();
+
+        for (const auto& rule : entry.m_rules)
+        {
+            CompiledRule compiledRule;
+            compiledRule.m_rule = rule.get();
+
+            for (const auto& condition : rule->m_conditions)
+                compiledRule.m_conditions.emplace_back(CompileCondition(condition.get()));
+
+            compiledEntry.m_rules.emplace_back(std::move(compiledRule));
+        }
+
+        m_compiled_entries.emplace_back(std::move(compiledEntry));
+    }
+}
+
+size_t StateMapHandler::GetVarValueCount(const size_t varIndex) const
+{
+    // The last value index is used when none of the values of the var matches
+    return m_state_map_layout.m_var_layout.m_vars[varIndex].m_values.size() + 1u;
+}
+
+StateMapHandler::CompiledCondition StateMapHandler::CompileCondition(const ISimpleExpression* condition) const
+{
+    CompiledCondition result{condition, false, {}, {}};
+
+    std::vector<std::string> names;
+    if (!CollectScopeValueNames(condition, names))
+        return result;
+
+    const auto& vars = m_state_map_layout.m_var_layout.m_vars;
+    for (const auto& name : names)
+    {
+        // Names that are not part of the layout never have a value so they do not need to be part of the table
+        const auto foundVar = std::find_if(vars.begin(), vars.end(), [&name](const StateMapLayoutVar& var)
+        {
+            return var.m_name == name;
+        });
+
+        if (foundVar == vars.end())
+            continue;
+
+        const auto varIndex = static_cast<size_t>(foundVar - vars.begin());
+        if (std::find(result.m_var_indices.begin(), result.m_var_indices.end(), varIndex) == result.m_var_indices.end())
+            result.m_var_indices.push_back(varIndex);
+    }
+
+    size_t tableSize = 1u;
+    for (const auto varIndex : result.m_var_indices)
+    {
+        tableSize *= GetVarValueCount(varIndex);
+        if (tableSize > MAX_CONDITION_TABLE_SIZE)
+            return result;
+    }
+
+    std::vector<size_t> valueIndices(vars.size(), 0u);
+    result.m_table.resize(tableSize);
+    for (auto tableIndex = 0u; tableIndex < tableSize; tableIndex++)
+    {
+        auto remainingIndex = tableIndex;
+        for (const auto varIndex : result.m_var_indices)
+        {
+            const auto valueCount = GetVarValueCount(varIndex);
+            valueIndices[varIndex] = remainingIndex % valueCount;
+            remainingIndex /= valueCount;
+        }
+
+        const auto tableVars = BuildVars(result.m_var_indices, valueIndices);
+        result.m_table[tableIndex] = condition->EvaluateNonStatic(&tableVars).IsTruthy();
+    }
+
+    result.m_has_table = true;
+    return result;
 }
 
 void StateMapHandler::ApplyStateMap(const uint32_t* baseStateBits, uint32_t* outStateBits) const
@@ -32,48 +159,109 @@ void StateMapHandler::ApplyStateMap(const uint32_t* baseStateBits, uint32_t* out
     assert(baseStateBits != nullptr);
     assert(outStateBits != nullptr);
 
-    const auto vars = BuildVars(baseStateBits);
+    const auto stateBitsCount = m_state_map_layout.m_state_bits_count;
+    std::string cacheKey(reinterpret_cast<const char*>(baseStateBits), stateBitsCount * sizeof(uint32_t));
 
-    for (auto i = 0u; i < m_state_map_layout.m_state_bits_count; i++)
+    const auto cachedResult = m_result_cache.find(cacheKey);
+    if (cachedResult != m_result_cache.end())
+    {
+        std::copy(cachedResult->second.begin(), cachedResult->second.end(), outStateBits);
+        return;
+    }
+
+    std::vector<size_t> valueIndices;
+    ReadVarValues(baseStateBits, valueIndices);
+
+    for (auto i = 0u; i < stateBitsCount; i++)
         outStateBits[i] = baseStateBits[i];
 
-    for (auto entryIndex = 0u; entryIndex < m_state_map.m_state_map_entries.size(); entryIndex++)
+    // Only built when a condition cannot be looked up in a table
+    const StateMapVars* allVars = nullptr;
+    StateMapVars allVarsStorage;
+
+    for (auto entryIndex = 0u; entryIndex < m_compiled_entries.size(); entryIndex++)
     {
-        const auto& entry = m_state_map.m_state_map_entries[entryIndex];
-        const auto matchingRule = std::find_if(entry.m_rules.begin(), entry.m_rules.end(), [&vars](const std::unique_ptr<StateMapRule>& rule)
+        const auto& entry = m_compiled_entries[entryIndex];
+        const auto matchingRule = std::find_if(entry.m_rules.begin(), entry.m_rules.end(), [this, &valueIndices, &allVars, &allVarsStorage](const CompiledRule& rule)
         {
-            const auto matchingCondition = std::find_if(rule->m_conditions.begin(), rule->m_conditions.end(), [&vars](std::unique_ptr<ISimpleExpression>& condition)
-            {
-                return condition->EvaluateNonStatic(&vars).IsTruthy();
-            });
+            const auto matchingCondition = std::find_if(rule.m_conditions.begin(), rule.m_conditions.end(),
+                                                        [this, &valueIndices, &allVars, &allVarsStorage](const CompiledCondition& condition)
+                                                        {
+                                                            return EvaluateCondition(condition, valueIndices, allVars, allVarsStorage);
+                                                        });
 
-            return matchingCondition != rule->m_conditions.end();
+            return matchingCondition != rule.m_conditions.end();
         });
 
         if (matchingRule != entry.m_rules.end())
-            ApplyRule(m_state_map_layout.m_entry_layout.m_entries[entryIndex], **matchingRule, outStateBits);
+            ApplyRule(m_state_map_layout.m_entry_layout.m_entries[entryIndex], *matchingRule->m_rule, outStateBits);
         else
-            ApplyRule(m_state_map_layout.m_entry_layout.m_entries[entryIndex], *entry.m_rules[entry.m_default_index], outStateBits);
+            ApplyRule(m_state_map_layout.m_entry_layout.m_entries[entryIndex], *entry.m_default_rule, outStateBits);
     }
+
+    m_result_cache.emplace(std::make_pair(std::move(cacheKey), std::vector<uint32_t>(outStateBits, outStateBits + stateBitsCount)));
 }
 
-StateMapVars StateMapHandler::BuildVars(const uint32_t* baseStateBits) const
+bool StateMapHandler::EvaluateCondition(const CompiledCondition& condition,
+                                        const std::vector<size_t>& valueIndices,
+                                        const StateMapVars*& allVars,
+                                        StateMapVars& allVarsStorage) const
 {
-    StateMapVars result;
+    if (condition.m_has_table)
+    {
+        size_t tableIndex = 0u;
+        size_t stride = 1u;
+        for (const auto varIndex : condition.m_var_indices)
+        {
+            tableIndex += valueIndices[varIndex] * stride;
+            stride *= GetVarValueCount(varIndex);
+        }
 
-    for (const auto& var : m_state_map_layout.m_var_layout.m_vars)
+        return condition.m_table[tableIndex];
+    }
+
+    if (!allVars)
+    {
+        allVarsStorage = BuildVars(m_all_var_indices, valueIndices);
+        allVars = &allVarsStorage;
+    }
+
+    return condition.m_expression->EvaluateNonStatic(allVars).IsTruthy();
+}
+
+void StateMapHandler::ReadVarValues(const uint32_t* baseStateBits, std::vector<size_t>& valueIndices) const
+{
+    const auto& vars = m_state_map_layout.m_var_layout.m_vars;
+    valueIndices.resize(vars.size());
+
+    for (auto varIndex = 0u; varIndex < vars.size(); varIndex++)
     {
+        const auto& var = vars[varIndex];
         const auto baseStateBitField = baseStateBits[var.m_state_bits_index];
         const auto matchingValue = std::find_if(var.m_values.begin(), var.m_values.end(), [&baseStateBitField](const StateMapLayoutVarValue& value)
         {
             return (baseStateBitField & value.m_state_bits_mask) == value.m_state_bits_mask;
         });
 
-        if (matchingValue != var.m_values.end())
-            result.AddValue(var.m_name, matchingValue->m_name);
-        else
+        valueIndices[varIndex] = static_cast<size_t>(matchingValue - var.m_values.begin());
+
+        if (matchingValue == var.m_values.end())
             std::cerr << "Could not find base value for state map var \"" << var.m_name << "\"\n";
     }
+}
+
+StateMapVars StateMapHandler::BuildVars(const std::vector<size_t>& varIndices, const std::vector<size_t>& valueIndices) const
+{
+    StateMapVars result;
+
+    for (const auto varIndex : varIndices)
+    {
+        const auto& var = m_state_map_layout.m_var_layout.m_vars[varIndex];
+        const auto valueIndex = valueIndices[varIndex];
+
+        if (valueIndex < var.m_values.size())
+            result.AddValue(var.m_name, var.m_values[valueIndex].m_name);
+    }
 
     return result;
 }
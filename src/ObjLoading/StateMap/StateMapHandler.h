@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Utils/ClassUtils.h"
 #include "StateMap/StateMapDefinition.h"
@@ -19,6 +21,11 @@ namespace state_map
         std::unordered_map<std::string, std::string> m_vars;
     };
 
+    /**
+     * \brief Applies a state map to state bits.
+     * The state map is compiled on construction: Vars are coded as the index of their value in the layout and conditions become truth tables over the values of the vars they use.
+     * Results are cached per base state bits, so a handler should be kept around for as long as its state map is used.
+     */
     class StateMapHandler
     {
     public:
@@ -27,10 +34,46 @@ namespace state_map
         void ApplyStateMap(const uint32_t* baseStateBits, uint32_t* outStateBits) const;
 
     private:
-        StateMapVars BuildVars(const uint32_t* baseStateBits) const;
+        // Conditions with more value combinations than this are evaluated on demand instead of being put into a table
+        static constexpr size_t MAX_CONDITION_TABLE_SIZE = 4096;
+
+        class CompiledCondition
+        {
+        public:
+            const ISimpleExpression* m_expression;
+            bool m_has_table;
+            std::vector<size_t> m_var_indices;
+            std::vector<bool> m_table;
+        };
+
+        class CompiledRule
+        {
+        public:
+            std::vector<CompiledCondition> m_conditions;
+            const StateMapRule* m_rule;
+        };
+
+        class CompiledEntry
+        {
+        public:
+            std::vector<CompiledRule> m_rules;
+            const StateMapRule* m_default_rule;
+        };
+
+        void CompileStateMap();
+        _NODISCARD CompiledCondition CompileCondition(const ISimpleExpression* condition) const;
+        _NODISCARD size_t GetVarValueCount(size_t varIndex) const;
+
+        void ReadVarValues(const uint32_t* baseStateBits, std::vector<size_t>& valueIndices) const;
+        _NODISCARD StateMapVars BuildVars(const std::vector<size_t>& varIndices, const std::vector<size_t>& valueIndices) const;
+        _NODISCARD bool EvaluateCondition(const CompiledCondition& condition, const std::vector<size_t>& valueIndices, const StateMapVars*& allVars, StateMapVars& allVarsStorage) const;
         static void ApplyRule(const StateMapLayoutEntry& entry, const StateMapRule& rule, uint32_t* outStateBits);
 
         const StateMapLayout& m_state_map_layout;
         const StateMapDefinition& m_state_map;
+
+        std::vector<size_t> m_all_var_indices;
+        std::vector<CompiledEntry> m_compiled_entries;
+        mutable std::unordered_map<std::string, std::vector<uint32_t>> m_result_cache;
     };
 }
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Crypto.h"
+#include "Utils/ClassUtils.h"
+#include "AssetLoading/ISessionAssetLoaderState.h"
+
+namespace techset
+{
+    /**
+     * \brief Keeps the results of parsing files for all zones of a session, so zones that read the same files do not need to parse them again.
+     * Results are looked up by the name of the file they were parsed from and a hash of its content, so a file is parsed again whenever its content changed.
+     * Can be used by multiple threads at the same time.
+     */
+    template<typename T>
+    class ParsedFileCache final : public ISessionAssetLoaderState
+    {
+        class CacheEntry
+        {
+        public:
+            std::vector<uint8_t> m_file_hash;
+            std::shared_ptr<const T> m_parsed_file;
+        };
+
+        std::mutex m_mutex;
+        std::unordered_map<std::string, CacheEntry> m_entries;
+
+    public:
+        _NODISCARD static std::vector<uint8_t> HashFileContent(const std::string& fileContent)
+        {
+            const auto hashFunction = Crypto::CreateSHA1();
+            hashFunction->Init();
+            hashFunction->Process(fileContent.data(), fileContent.size());
+
+            std::vector<uint8_t> hash(hashFunction->GetHashSize());
+            hashFunction->Finish(hash.data());
+
+            return hash;
+        }
+
+        std::shared_ptr<const T> GetParsedFile(const std::string& fileName, const std::vector<uint8_t>& fileHash)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            const auto foundEntry = m_entries.find(fileName);
+            if (foundEntry == m_entries.end() || foundEntry->second.m_file_hash != fileHash)
+                return nullptr;
+
+            return foundEntry->second.m_parsed_file;
+        }
+
+        void AddParsedFile(const std::string& fileName, std::vector<uint8_t> fileHash, std::shared_ptr<const T> parsedFile)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            // Only the result for the latest content of a file is kept
+            auto& entry = m_entries[fileName];
+            entry.m_file_hash = std::move(fileHash);
+            entry.m_parsed_file = std::move(parsedFile);
+        }
+    };
+}
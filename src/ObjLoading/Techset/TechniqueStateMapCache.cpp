@@ -12,7 +12,7 @@ const state_map::StateMapDefinition* TechniqueStateMapCache::GetCachedStateMap(c
     return nullptr;
 }
 
-void TechniqueStateMapCache::AddStateMapToCache(std::unique_ptr<state_map::StateMapDefinition> stateMap)
+void TechniqueStateMapCache::AddStateMapToCache(std::shared_ptr<const state_map::StateMapDefinition> stateMap)
 {
     m_state_map_cache.emplace(std::make_pair(stateMap->m_name, std::move(stateMap)));
 }
@@ -31,3 +31,17 @@ void TechniqueStateMapCache::SetTechniqueUsesStateMap(std::string techniqueName,
 {
     m_state_map_per_technique.emplace(std::make_pair(std::move(techniqueName), stateMap));
 }
+
+const state_map::StateMapHandler& TechniqueStateMapCache::GetStateMapHandler(const state_map::StateMapLayout& stateMapLayout, const state_map::StateMapDefinition& stateMap)
+{
+    const auto foundHandler = m_state_map_handlers.find(&stateMap);
+
+    if (foundHandler != m_state_map_handlers.end())
+        return *foundHandler->second;
+
+    auto handler = std::make_unique<state_map::StateMapHandler>(stateMapLayout, stateMap);
+    const auto* handlerPtr = handler.get();
+    m_state_map_handlers.emplace(std::make_pair(&stateMap, std::move(handler)));
+
+    return *handlerPtr;
+}
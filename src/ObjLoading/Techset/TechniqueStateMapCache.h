@@ -6,21 +6,31 @@
 
 #include "AssetLoading/IZoneAssetLoaderState.h"
 #include "Utils/ClassUtils.h"
+#include "ParsedFileCache.h"
 #include "StateMap/StateMapDefinition.h"
+#include "StateMap/StateMapHandler.h"
 
 namespace techset
 {
+    typedef ParsedFileCache<state_map::StateMapDefinition> StateMapDefinitionFileCache;
+
     class TechniqueStateMapCache final : public IZoneAssetLoaderState
     {
     public:
         _NODISCARD const state_map::StateMapDefinition* GetCachedStateMap(const std::string& name) const;
-        void AddStateMapToCache(std::unique_ptr<state_map::StateMapDefinition> stateMap);
+        void AddStateMapToCache(std::shared_ptr<const state_map::StateMapDefinition> stateMap);
 
         _NODISCARD const state_map::StateMapDefinition* GetStateMapForTechnique(const std::string& techniqueName) const;
         void SetTechniqueUsesStateMap(std::string techniqueName, const state_map::StateMapDefinition* stateMap);
 
+        /**
+         * \brief Returns the handler for a state map, compiling it on first use. All state maps of a zone must use the same layout.
+         */
+        const state_map::StateMapHandler& GetStateMapHandler(const state_map::StateMapLayout& stateMapLayout, const state_map::StateMapDefinition& stateMap);
+
     private:
         std::unordered_map<std::string, const state_map::StateMapDefinition*> m_state_map_per_technique;
-        std::unordered_map<std::string, std::unique_ptr<state_map::StateMapDefinition>> m_state_map_cache;
+        std::unordered_map<std::string, std::shared_ptr<const state_map::StateMapDefinition>> m_state_map_cache;
+        std::unordered_map<const state_map::StateMapDefinition*, std::unique_ptr<state_map::StateMapHandler>> m_state_map_handlers;
     };
 }
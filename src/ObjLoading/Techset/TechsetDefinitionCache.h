@@ -5,18 +5,21 @@
 #include <memory>
 
 #include "Utils/ClassUtils.h"
+#include "ParsedFileCache.h"
 #include "TechsetDefinition.h"
 #include "AssetLoading/IZoneAssetLoaderState.h"
 
 namespace techset
 {
+    typedef ParsedFileCache<TechsetDefinition> TechsetDefinitionFileCache;
+
     class TechsetDefinitionCache final : public IZoneAssetLoaderState
     {
     public:
-        _NODISCARD TechsetDefinition* GetCachedTechsetDefinition(const std::string& techsetName) const;
-        void AddTechsetDefinitionToCache(std::string name, std::unique_ptr<TechsetDefinition> definition);
+        _NODISCARD const TechsetDefinition* GetCachedTechsetDefinition(const std::string& techsetName) const;
+        void AddTechsetDefinitionToCache(std::string name, std::shared_ptr<const TechsetDefinition> definition);
 
     private:
-        std::unordered_map<std::string, std::unique_ptr<TechsetDefinition>> m_cache;
+        std::unordered_map<std::string, std::shared_ptr<const TechsetDefinition>> m_cache;
     };
 }
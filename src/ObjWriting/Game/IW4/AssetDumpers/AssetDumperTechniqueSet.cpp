@@ -27,10 +27,15 @@ namespace IW4
             m_dumped_techniques.emplace(technique);
             return true;
         }
+
+        // Shaders are shared by many techniques of a zone, so each of them is only analysed once
+        d3d9::ShaderInfoCache m_shader_info_cache;
     };
 
     class TechniqueFileWriter : public AbstractTextDumper
     {
+        d3d9::ShaderInfoCache& m_shader_info_cache;
+
         void DumpStateMap() const
         {
             Indent();
@@ -265,7 +270,7 @@ namespace IW4
                 vertexShader = loadedVertexShaderFromOtherZone->Asset();
             }
 
-            const auto vertexShaderInfo = d3d9::ShaderAnalyser::GetShaderInfo(vertexShader->prog.loadDef.program, vertexShader->prog.loadDef.programSize * sizeof(uint32_t));
+            const auto* vertexShaderInfo = m_shader_info_cache.GetShaderInfo(vertexShader->prog.loadDef.program, vertexShader->prog.loadDef.programSize * sizeof(uint32_t));
             assert(vertexShaderInfo);
             if (!vertexShaderInfo)
                 return;
@@ -321,7 +326,7 @@ namespace IW4
                 pixelShader = loadedPixelShaderFromOtherZone->Asset();
             }
 
-            const auto pixelShaderInfo = d3d9::ShaderAnalyser::GetShaderInfo(pixelShader->prog.loadDef.program, pixelShader->prog.loadDef.programSize * sizeof(uint32_t));
+            const auto* pixelShaderInfo = m_shader_info_cache.GetShaderInfo(pixelShader->prog.loadDef.program, pixelShader->prog.loadDef.programSize * sizeof(uint32_t));
             assert(pixelShaderInfo);
             if (!pixelShaderInfo)
                 return;
@@ -440,8 +445,9 @@ namespace IW4
         }
 
     public:
-        explicit TechniqueFileWriter(std::ostream& stream)
-            : AbstractTextDumper(stream)
+        TechniqueFileWriter(std::ostream& stream, d3d9::ShaderInfoCache& shaderInfoCache)
+            : AbstractTextDumper(stream),
+              m_shader_info_cache(shaderInfoCache)
         {
         }
 
@@ -566,7 +572,7 @@ void AssetDumperTechniqueSet::DumpAsset(AssetDumpingContext& context, XAssetInfo
             const auto techniqueFile = context.OpenAssetFile(GetTechniqueFileName(technique));
             if (techniqueFile)
             {
-                TechniqueFileWriter writer(*techniqueFile);
+                TechniqueFileWriter writer(*techniqueFile, techniqueState->m_shader_info_cache);
                 writer.DumpTechnique(technique);
             }
         }
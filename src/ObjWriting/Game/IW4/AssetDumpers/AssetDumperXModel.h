@@ -15,9 +15,8 @@ namespace IW4
         static GfxImage* GetMaterialSpecularMap(const Material* material);
 
         static void AddObjMaterials(ObjWriter& writer, DistinctMapper<Material*>& materialMapper, const XModel* model);
-        static void AddObjObjects(ObjWriter& writer, const DistinctMapper<Material*>& materialMapper, const XModelSurfs* modelSurfs, int baseSurfaceIndex);
-        static void AddObjVertices(ObjWriter& writer, const XModelSurfs* modelSurfs);
-        static void AddObjFaces(ObjWriter& writer, const XModelSurfs* modelSurfs);
+        static void AddObjSurface(ObjWriter& writer, const DistinctMapper<Material*>& materialMapper, const XSurface& surface, unsigned surfIndex, int baseSurfaceIndex);
+        static size_t GetLodVertexCount(const XModel* model, unsigned lod);
         static void DumpObjLod(const AssetDumpingContext& context, XAssetInfo<XModel>* asset, const unsigned lod);
         static void DumpObjMat(const AssetDumpingContext& context, XAssetInfo<XModel>* asset);
         static void DumpObj(AssetDumpingContext& context, XAssetInfo<XModel>* asset);
@@ -25,10 +24,6 @@ namespace IW4
         static void AddXModelBones(const AssetDumpingContext& context, AbstractXModelWriter& writer, const XModel* model);
         static void AddXModelMaterials(AbstractXModelWriter& writer, DistinctMapper<Material*>& materialMapper, const XModel* model);
         static void AddXModelObjects(AbstractXModelWriter& writer, const XModelSurfs* modelSurfs);
-        static void AddXModelVertices(AbstractXModelWriter& writer, const XModelSurfs* modelSurfs);
-        static void AllocateXModelBoneWeights(const XModelSurfs* modelSurfs, XModelVertexBoneWeightCollection& weightCollection);
-        static void AddXModelVertexBoneWeights(AbstractXModelWriter& writer, const XModelSurfs* modelSurfs, XModelVertexBoneWeightCollection& weightCollection);
-        static void AddXModelFaces(AbstractXModelWriter& writer, const DistinctMapper<Material*>& materialMapper, const XModelSurfs* modelSurfs, int baseSurfaceIndex);
         static void DumpXModelExportLod(const AssetDumpingContext& context, XAssetInfo<XModel>* asset, unsigned lod);
         static void DumpXModelExport(AssetDumpingContext& context, XAssetInfo<XModel>* asset);
 
@@ -118,6 +118,8 @@ void InfoStringFromStructConverter::FillFromBaseField(const cspField_t& field)
 
 void InfoStringFromStructConverter::FillInfoString()
 {
+    m_info_string.Reserve(m_field_count);
+
     for (auto fieldIndex = 0u; fieldIndex < m_field_count; fieldIndex++)
     {
         const auto& field = m_fields[fieldIndex];
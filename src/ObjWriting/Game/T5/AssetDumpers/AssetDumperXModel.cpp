@@ -6,12 +6,173 @@
 #include "ObjWriting.h"
 #include "Game/T5/CommonT5.h"
 #include "Math/Quaternion.h"
+#include "Model/ModelLodDumpingZoneState.h"
 #include "Model/XModel/XModelExportWriter.h"
 #include "Utils/HalfFloat.h"
 #include "Utils/QuatInt16.h"
 
 using namespace T5;
 
+namespace T5
+{
+    class XModelLodSurfaceSource final : public IXModelSurfaceSource
+    {
+        const XSurface* m_surfaces;
+        size_t m_surface_count;
+        size_t m_base_surface_index;
+        const DistinctMapper<Material*>& m_material_mapper;
+
+        static void AddVertexBoneWeights(std::vector<XModelVertexBoneWeights>& vertexBoneWeights, const uint16_t* vertsBlend, const size_t weightCount)
+        {
+            XModelVertexBoneWeights weights{};
+            weights.weightCount = weightCount;
+
+            auto boneWeight0 = 1.0f;
+            for (auto weightIndex = 1u; weightIndex < weightCount; weightIndex++)
+            {
+                const auto boneWeight = HalfFloat::ToFloat(vertsBlend[weightIndex * 2]);
+                weights.weights[weightIndex] = XModelBoneWeight{
+                    static_cast<int>(vertsBlend[weightIndex * 2 - 1] / sizeof(DObjSkelMat)),
+                    boneWeight
+                };
+                boneWeight0 -= boneWeight;
+            }
+
+            weights.weights[0] = XModelBoneWeight{
+                static_cast<int>(vertsBlend[0] / sizeof(DObjSkelMat)),
+                boneWeight0
+            };
+
+            vertexBoneWeights.emplace_back(weights);
+        }
+
+    public:
+        XModelLodSurfaceSource(const XSurface* surfaces, const size_t surfaceCount, const size_t baseSurfaceIndex, const DistinctMapper<Material*>& materialMapper)
+            : m_surfaces(surfaces),
+              m_surface_count(surfaces ? surfaceCount : 0u),
+              m_base_surface_index(baseSurfaceIndex),
+              m_material_mapper(materialMapper)
+        {
+        }
+
+        _NODISCARD size_t GetSurfaceCount() const override
+        {
+            return m_surface_count;
+        }
+
+        _NODISCARD size_t GetSurfaceVertexCount(const size_t surfaceIndex) const override
+        {
+            return m_surfaces[surfaceIndex].vertCount;
+        }
+
+        _NODISCARD size_t GetSurfaceFaceCount(const size_t surfaceIndex) const override
+        {
+            return m_surfaces[surfaceIndex].triCount;
+        }
+
+        void ReadSurfaceVertices(const size_t surfaceIndex, std::vector<XModelVertex>& vertices) const override
+        {
+            const auto& surface = m_surfaces[surfaceIndex];
+            vertices.reserve(vertices.size() + surface.vertCount);
+
+            for (auto vertexIndex = 0u; vertexIndex < surface.vertCount; vertexIndex++)
+            {
+                const auto& v = surface.verts0[vertexIndex];
+                vec2_t uv{};
+                vec3_t normalVec{};
+                vec4_t color{};
+
+                Common::Vec2UnpackTexCoords(v.texCoord, &uv);
+                Common::Vec3UnpackUnitVec(v.normal, &normalVec);
+                Common::Vec4UnpackGfxColor(v.color, &color);
+
+                XModelVertex vertex{};
+                vertex.coordinates[0] = v.xyz[0];
+                vertex.coordinates[1] = v.xyz[1];
+                vertex.coordinates[2] = v.xyz[2];
+                vertex.normal[0] = normalVec[0];
+                vertex.normal[1] = normalVec[1];
+                vertex.normal[2] = normalVec[2];
+                vertex.color[0] = color[0];
+                vertex.color[1] = color[1];
+                vertex.color[2] = color[2];
+                vertex.color[3] = color[3];
+                vertex.uv[0] = uv[0];
+                vertex.uv[1] = uv[1];
+
+                vertices.emplace_back(vertex);
+            }
+        }
+
+        void ReadSurfaceVertexBoneWeights(const size_t surfaceIndex, std::vector<XModelVertexBoneWeights>& vertexBoneWeights) const override
+        {
+            const auto& surface = m_surfaces[surfaceIndex];
+            vertexBoneWeights.reserve(vertexBoneWeights.size() + surface.vertCount);
+            auto handledVertices = 0u;
+
+            if (surface.vertList)
+            {
+                for (auto vertListIndex = 0u; vertListIndex < surface.vertListCount; vertListIndex++)
+                {
+                    const auto& vertList = surface.vertList[vertListIndex];
+
+                    XModelVertexBoneWeights weights{};
+                    weights.weights[0] = XModelBoneWeight{
+                        static_cast<int>(vertList.boneOffset / sizeof(DObjSkelMat)),
+                        1.0f
+                    };
+                    weights.weightCount = 1;
+
+                    for (auto vertListVertexOffset = 0u; vertListVertexOffset < vertList.vertCount; vertListVertexOffset++)
+                        vertexBoneWeights.emplace_back(weights);
+
+                    handledVertices += vertList.vertCount;
+                }
+            }
+
+            if (surface.vertInfo.vertsBlend)
+            {
+                // Vertices with n bone weights use 2n - 1 blend values: The first bone index followed by pairs of bone index and weight
+                auto vertsBlendOffset = 0u;
+                for (auto weightCountIndex = 0u; weightCountIndex < 4u; weightCountIndex++)
+                {
+                    const auto weightCount = weightCountIndex + 1u;
+                    for (auto vertIndex = 0; vertIndex < surface.vertInfo.vertCount[weightCountIndex]; vertIndex++)
+                    {
+                        AddVertexBoneWeights(vertexBoneWeights, &surface.vertInfo.vertsBlend[vertsBlendOffset], weightCount);
+                        vertsBlendOffset += weightCount * 2 - 1;
+                    }
+
+                    handledVertices += surface.vertInfo.vertCount[weightCountIndex];
+                }
+            }
+
+            for (; handledVertices < surface.vertCount; handledVertices++)
+                vertexBoneWeights.emplace_back(XModelVertexBoneWeights{});
+        }
+
+        void ReadSurfaceFaces(const size_t surfaceIndex, std::vector<XModelFace>& faces) const override
+        {
+            const auto& surface = m_surfaces[surfaceIndex];
+            const auto materialIndex = static_cast<int>(m_material_mapper.GetDistinctPositionByInputPosition(surfaceIndex + m_base_surface_index));
+            faces.reserve(faces.size() + surface.triCount);
+
+            for (auto triIndex = 0u; triIndex < surface.triCount; triIndex++)
+            {
+                const auto& tri = surface.triIndices[triIndex];
+
+                XModelFace face{};
+                face.vertexIndex[0] = tri[0];
+                face.vertexIndex[1] = tri[1];
+                face.vertexIndex[2] = tri[2];
+                face.objectIndex = static_cast<int>(surfaceIndex);
+                face.materialIndex = materialIndex;
+                faces.emplace_back(face);
+            }
+        }
+    };
+}
+
 bool AssetDumperXModel::ShouldDump(XAssetInfo<XModel>* asset)
 {
     return !asset->m_name.empty() && asset->m_name[0] != ',';
@@ -124,83 +285,72 @@ void AssetDumperXModel::AddObjMaterials(ObjWriter& writer, DistinctMapper<Materi
     }
 }
 
-void AssetDumperXModel::AddObjObjects(ObjWriter& writer, const DistinctMapper<Material*>& materialMapper, const XModel* model, const unsigned lod)
+void AssetDumperXModel::AddObjSurface(ObjWriter& writer, const DistinctMapper<Material*>& materialMapper, const XSurface& surface, const unsigned surfIndex, const int baseSurfaceIndex)
 {
-    const auto surfCount = model->lodInfo[lod].numsurfs;
-    const auto baseSurfIndex = model->lodInfo[lod].surfIndex;
+    ObjObject object;
+    object.name = "surf" + std::to_string(surfIndex);
+    object.materialIndex = static_cast<int>(materialMapper.GetDistinctPositionByInputPosition(surfIndex + baseSurfaceIndex));
 
-    for (auto surfIndex = 0u; surfIndex < surfCount; surfIndex++)
-    {
-        ObjObject object;
-        object.name = "surf" + std::to_string(surfIndex);
-        object.materialIndex = static_cast<int>(materialMapper.GetDistinctPositionByInputPosition(surfIndex + baseSurfIndex));
+    writer.AddObject(std::move(object));
+    writer.ReserveObjectData(static_cast<int>(surfIndex), surface.vertCount, surface.triCount);
 
-        writer.AddObject(std::move(object));
+    for (auto vertexIndex = 0u; vertexIndex < surface.vertCount; vertexIndex++)
+    {
+        const auto& v = surface.verts0[vertexIndex];
+        vec2_t uv;
+        vec3_t normalVec;
+
+        Common::Vec2UnpackTexCoords(v.texCoord, &uv);
+        Common::Vec3UnpackUnitVec(v.normal, &normalVec);
+
+        ObjVertex objVertex{};
+        ObjNormal objNormal{};
+        ObjUv objUv{};
+        objVertex.coordinates[0] = v.xyz[0];
+        objVertex.coordinates[1] = v.xyz[2];
+        objVertex.coordinates[2] = -v.xyz[1];
+        objNormal.normal[0] = normalVec[0];
+        objNormal.normal[1] = normalVec[2];
+        objNormal.normal[2] = -normalVec[1];
+        objUv.uv[0] = uv[0];
+        objUv.uv[1] = 1.0f - uv[1];
+
+        writer.AddVertex(static_cast<int>(surfIndex), objVertex);
+        writer.AddNormal(static_cast<int>(surfIndex), objNormal);
+        writer.AddUv(static_cast<int>(surfIndex), objUv);
     }
-}
 
-void AssetDumperXModel::AddObjVertices(ObjWriter& writer, const XModel* model, const unsigned lod)
-{
-    const auto* surfs = &model->surfs[model->lodInfo[lod].surfIndex];
-    const auto surfCount = model->lodInfo[lod].numsurfs;
-
-    for (auto surfIndex = 0u; surfIndex < surfCount; surfIndex++)
+    for (auto triIndex = 0u; triIndex < surface.triCount; triIndex++)
     {
-        const auto& surface = surfs[surfIndex];
-
-        for (auto vertexIndex = 0u; vertexIndex < surface.vertCount; vertexIndex++)
-        {
-            const auto& v = surface.verts0[vertexIndex];
-            vec2_t uv;
-            vec3_t normalVec;
-
-            Common::Vec2UnpackTexCoords(v.texCoord, &uv);
-            Common::Vec3UnpackUnitVec(v.normal, &normalVec);
-
-            ObjVertex objVertex{};
-            ObjNormal objNormal{};
-            ObjUv objUv{};
-            objVertex.coordinates[0] = v.xyz[0];
-            objVertex.coordinates[1] = v.xyz[2];
-            objVertex.coordinates[2] = -v.xyz[1];
-            objNormal.normal[0] = normalVec[0];
-            objNormal.normal[1] = normalVec[2];
-            objNormal.normal[2] = -normalVec[1];
-            objUv.uv[0] = uv[0];
-            objUv.uv[1] = 1.0f - uv[1];
-
-            writer.AddVertex(static_cast<int>(surfIndex), objVertex);
-            writer.AddNormal(static_cast<int>(surfIndex), objNormal);
-            writer.AddUv(static_cast<int>(surfIndex), objUv);
-        }
+        const auto& tri = surface.triIndices[triIndex];
+
+        ObjFace face{};
+        face.vertexIndex[0] = tri[2];
+        face.vertexIndex[1] = tri[1];
+        face.vertexIndex[2] = tri[0];
+        face.normalIndex[0] = face.vertexIndex[0];
+        face.normalIndex[1] = face.vertexIndex[1];
+        face.normalIndex[2] = face.vertexIndex[2];
+        face.uvIndex[0] = face.vertexIndex[0];
+        face.uvIndex[1] = face.vertexIndex[1];
+        face.uvIndex[2] = face.vertexIndex[2];
+        writer.AddFace(static_cast<int>(surfIndex), face);
     }
 }
 
-void AssetDumperXModel::AddObjFaces(ObjWriter& writer, const XModel* model, const unsigned lod)
+size_t AssetDumperXModel::GetLodVertexCount(const XModel* model, const unsigned lod)
 {
+    if (!model->surfs)
+        return 0u;
+
     const auto* surfs = &model->surfs[model->lodInfo[lod].surfIndex];
     const auto surfCount = model->lodInfo[lod].numsurfs;
 
+    size_t vertexCount = 0u;
     for (auto surfIndex = 0u; surfIndex < surfCount; surfIndex++)
-    {
-        const auto& surface = surfs[surfIndex];
-        for (auto triIndex = 0u; triIndex < surface.triCount; triIndex++)
-        {
-            const auto& tri = surface.triIndices[triIndex];
-
-            ObjFace face{};
-            face.vertexIndex[0] = tri[2] + surface.baseVertIndex;
-            face.vertexIndex[1] = tri[1] + surface.baseVertIndex;
-            face.vertexIndex[2] = tri[0] + surface.baseVertIndex;
-            face.normalIndex[0] = face.vertexIndex[0];
-            face.normalIndex[1] = face.vertexIndex[1];
-            face.normalIndex[2] = face.vertexIndex[2];
-            face.uvIndex[0] = face.vertexIndex[0];
-            face.uvIndex[1] = face.vertexIndex[1];
-            face.uvIndex[2] = face.vertexIndex[2];
-            writer.AddFace(static_cast<int>(surfIndex), face);
-        }
-    }
+        vertexCount += surfs[surfIndex].vertCount;
+
+    return vertexCount;
 }
 
 void AssetDumperXModel::DumpObjMat(const AssetDumpingContext& context, XAssetInfo<XModel>* asset)
@@ -233,22 +383,33 @@ void AssetDumperXModel::DumpObjLod(AssetDumpingContext& context, XAssetInfo<XMod
     DistinctMapper<Material*> materialMapper(model->numsurfs);
 
     AddObjMaterials(writer, materialMapper, model);
-    AddObjObjects(writer, materialMapper, model, lod);
-    AddObjVertices(writer, model, lod);
-    AddObjFaces(writer, model, lod);
+    writer.WriteObjHeader(*assetFile, std::string(model->name) + ".mtl");
 
-    writer.WriteObj(*assetFile, std::string(model->name) + ".mtl");
+    // Write every surface as soon as it is complete to only keep one surface in memory
+    const auto* surfs = &model->surfs[model->lodInfo[lod].surfIndex];
+    const auto surfCount = model->lodInfo[lod].numsurfs;
+    for (auto surfIndex = 0u; surfIndex < surfCount; surfIndex++)
+    {
+        AddObjSurface(writer, materialMapper, surfs[surfIndex], surfIndex, model->lodInfo[lod].surfIndex);
+        writer.WriteObjObjects(*assetFile);
+    }
 }
 
 void AssetDumperXModel::DumpObj(AssetDumpingContext& context, XAssetInfo<XModel>* asset)
 {
     const auto* model = asset->Asset();
 
+    auto* lodZoneState = context.GetZoneAssetDumperState<ModelLodDumpingZoneState>();
+
     DumpObjMat(context, asset);
     for (auto currentLod = 0u; currentLod < model->numLods; currentLod++)
     {
-        DumpObjLod(context, asset, currentLod);
+        lodZoneState->DumpLod(GetLodVertexCount(model, currentLod), [&context, asset, currentLod]
+        {
+            DumpObjLod(context, asset, currentLod);
+        });
     }
+    lodZoneState->WaitForLods();
 }
 
 void AssetDumperXModel::AddXModelBones(const AssetDumpingContext& context, AbstractXModelWriter& writer, const XModel* model)
@@ -332,261 +493,6 @@ void AssetDumperXModel::AddXModelObjects(AbstractXModelWriter& writer, const XMo
     }
 }
 
-void AssetDumperXModel::AddXModelVertices(AbstractXModelWriter& writer, const XModel* model, const unsigned lod)
-{
-    const auto* surfs = &model->surfs[model->lodInfo[lod].surfIndex];
-    const auto surfCount = model->lodInfo[lod].numsurfs;
-
-    for (auto surfIndex = 0u; surfIndex < surfCount; surfIndex++)
-    {
-        const auto& surface = surfs[surfIndex];
-
-        for (auto vertexIndex = 0u; vertexIndex < surface.vertCount; vertexIndex++)
-        {
-            const auto& v = surface.verts0[vertexIndex];
-            vec2_t uv;
-            vec3_t normalVec;
-            vec4_t color;
-
-            Common::Vec2UnpackTexCoords(v.texCoord, &uv);
-            Common::Vec3UnpackUnitVec(v.normal, &normalVec);
-            Common::Vec4UnpackGfxColor(v.color, &color);
-
-            XModelVertex vertex{};
-            vertex.coordinates[0] = v.xyz[0];
-            vertex.coordinates[1] = v.xyz[1];
-            vertex.coordinates[2] = v.xyz[2];
-            vertex.normal[0] = normalVec[0];
-            vertex.normal[1] = normalVec[1];
-            vertex.normal[2] = normalVec[2];
-            vertex.color[0] = color[0];
-            vertex.color[1] = color[1];
-            vertex.color[2] = color[2];
-            vertex.color[3] = color[3];
-            vertex.uv[0] = uv[0];
-            vertex.uv[1] = uv[1];
-
-            writer.AddVertex(vertex);
-        }
-    }
-}
-
-void AssetDumperXModel::AllocateXModelBoneWeights(const XModel* model, const unsigned lod, XModelVertexBoneWeightCollection& weightCollection)
-{
-    const auto* surfs = &model->surfs[model->lodInfo[lod].surfIndex];
-    const auto surfCount = model->lodInfo[lod].numsurfs;
-
-    weightCollection.totalWeightCount = 0u;
-    for (auto surfIndex = 0u; surfIndex < surfCount; surfIndex++)
-    {
-        const auto& surface = surfs[surfIndex];
-
-        if (surface.vertList)
-        {
-            weightCollection.totalWeightCount += surface.vertListCount;
-        }
-
-        if (surface.vertInfo.vertsBlend)
-        {
-            weightCollection.totalWeightCount += surface.vertInfo.vertCount[0] * 1;
-            weightCollection.totalWeightCount += surface.vertInfo.vertCount[1] * 2;
-            weightCollection.totalWeightCount += surface.vertInfo.vertCount[2] * 3;
-            weightCollection.totalWeightCount += surface.vertInfo.vertCount[3] * 4;
-        }
-    }
-
-    weightCollection.weights = std::make_unique<XModelBoneWeight[]>(weightCollection.totalWeightCount);
-}
-
-void AssetDumperXModel::AddXModelVertexBoneWeights(AbstractXModelWriter& writer, const XModel* model, const unsigned lod, XModelVertexBoneWeightCollection& weightCollection)
-{
-    const auto* surfs = &model->surfs[model->lodInfo[lod].surfIndex];
-    const auto surfCount = model->lodInfo[lod].numsurfs;
-
-    size_t weightOffset = 0u;
-
-    for (auto surfIndex = 0u; surfIndex < surfCount; surfIndex++)
-    {
-        const auto& surface = surfs[surfIndex];
-        auto handledVertices = 0u;
-
-        if (surface.vertList)
-        {
-            for (auto vertListIndex = 0u; vertListIndex < surface.vertListCount; vertListIndex++)
-            {
-                const auto& vertList = surface.vertList[vertListIndex];
-                const auto* boneWeightOffset = &weightCollection.weights[weightOffset];
-
-                weightCollection.weights[weightOffset++] = XModelBoneWeight{
-                    static_cast<int>(vertList.boneOffset / sizeof(DObjSkelMat)),
-                    1.0f
-                };
-
-                for (auto vertListVertexOffset = 0u; vertListVertexOffset < vertList.vertCount; vertListVertexOffset++)
-                {
-                    writer.AddVertexBoneWeights(XModelVertexBoneWeights{
-                        boneWeightOffset,
-                        1
-                    });
-                }
-                handledVertices += vertList.vertCount;
-            }
-        }
-
-        auto vertsBlendOffset = 0u;
-        if (surface.vertInfo.vertsBlend)
-        {
-            // 1 bone weight
-            for (auto vertIndex = 0; vertIndex < surface.vertInfo.vertCount[0]; vertIndex++)
-            {
-                const auto* boneWeightOffset = &weightCollection.weights[weightOffset];
-                const auto boneIndex0 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 0] / sizeof(DObjSkelMat));
-                weightCollection.weights[weightOffset++] = XModelBoneWeight{
-                    boneIndex0,
-                    1.0f
-                };
-
-                vertsBlendOffset += 1;
-
-                writer.AddVertexBoneWeights(XModelVertexBoneWeights{
-                    boneWeightOffset,
-                    1
-                });
-            }
-
-            // 2 bone weights
-            for (auto vertIndex = 0; vertIndex < surface.vertInfo.vertCount[1]; vertIndex++)
-            {
-                const auto* boneWeightOffset = &weightCollection.weights[weightOffset];
-                const auto boneIndex0 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 0] / sizeof(DObjSkelMat));
-                const auto boneIndex1 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 1] / sizeof(DObjSkelMat));
-                const auto boneWeight1 = HalfFloat::ToFloat(surface.vertInfo.vertsBlend[vertsBlendOffset + 2]);
-                const auto boneWeight0 = 1.0f - boneWeight1;
-
-                weightCollection.weights[weightOffset++] = XModelBoneWeight{
-                    boneIndex0,
-                    boneWeight0
-                };
-                weightCollection.weights[weightOffset++] = XModelBoneWeight{
-                    boneIndex1,
-                    boneWeight1
-                };
-
-                vertsBlendOffset += 3;
-
-                writer.AddVertexBoneWeights(XModelVertexBoneWeights{
-                    boneWeightOffset,
-                    2
-                });
-            }
-
-            // 3 bone weights
-            for (auto vertIndex = 0; vertIndex < surface.vertInfo.vertCount[2]; vertIndex++)
-            {
-                const auto* boneWeightOffset = &weightCollection.weights[weightOffset];
-                const auto boneIndex0 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 0] / sizeof(DObjSkelMat));
-                const auto boneIndex1 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 1] / sizeof(DObjSkelMat));
-                const auto boneWeight1 = HalfFloat::ToFloat(surface.vertInfo.vertsBlend[vertsBlendOffset + 2]);
-                const auto boneIndex2 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 3] / sizeof(DObjSkelMat));
-                const auto boneWeight2 = HalfFloat::ToFloat(surface.vertInfo.vertsBlend[vertsBlendOffset + 4]);
-                const auto boneWeight0 = 1.0f - boneWeight1 - boneWeight2;
-
-                weightCollection.weights[weightOffset++] = XModelBoneWeight{
-                    boneIndex0,
-                    boneWeight0
-                };
-                weightCollection.weights[weightOffset++] = XModelBoneWeight{
-                    boneIndex1,
-                    boneWeight1
-                };
-                weightCollection.weights[weightOffset++] = XModelBoneWeight{
-                    boneIndex2,
-                    boneWeight2
-                };
-
-                vertsBlendOffset += 5;
-
-                writer.AddVertexBoneWeights(XModelVertexBoneWeights{
-                    boneWeightOffset,
-                    3
-                });
-            }
-
-            // 4 bone weights
-            for (auto vertIndex = 0; vertIndex < surface.vertInfo.vertCount[3]; vertIndex++)
-            {
-                const auto* boneWeightOffset = &weightCollection.weights[weightOffset];
-                const auto boneIndex0 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 0] / sizeof(DObjSkelMat));
-                const auto boneIndex1 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 1] / sizeof(DObjSkelMat));
-                const auto boneWeight1 = HalfFloat::ToFloat(surface.vertInfo.vertsBlend[vertsBlendOffset + 2]);
-                const auto boneIndex2 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 3] / sizeof(DObjSkelMat));
-                const auto boneWeight2 = HalfFloat::ToFloat(surface.vertInfo.vertsBlend[vertsBlendOffset + 4]);
-                const auto boneIndex3 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 5] / sizeof(DObjSkelMat));
-                const auto boneWeight3 = HalfFloat::ToFloat(surface.vertInfo.vertsBlend[vertsBlendOffset + 6]);
-                const auto boneWeight0 = 1.0f - boneWeight1 - boneWeight2 - boneWeight3;
-
-                weightCollection.weights[weightOffset++] = XModelBoneWeight{
-                    boneIndex0,
-                    boneWeight0
-                };
-                weightCollection.weights[weightOffset++] = XModelBoneWeight{
-                    boneIndex1,
-                    boneWeight1
-                };
-                weightCollection.weights[weightOffset++] = XModelBoneWeight{
-                    boneIndex2,
-                    boneWeight2
-                };
-                weightCollection.weights[weightOffset++] = XModelBoneWeight{
-                    boneIndex3,
-                    boneWeight3
-                };
-
-                vertsBlendOffset += 7;
-
-                writer.AddVertexBoneWeights(XModelVertexBoneWeights{
-                    boneWeightOffset,
-                    4
-                });
-            }
-
-            handledVertices += surface.vertInfo.vertCount[0] + surface.vertInfo.vertCount[1] + surface.vertInfo.vertCount[2] + surface.vertInfo.vertCount[3];
-        }
-
-        for (; handledVertices < surface.vertCount; handledVertices++)
-        {
-            writer.AddVertexBoneWeights(XModelVertexBoneWeights{
-                nullptr,
-                0
-            });
-        }
-    }
-}
-
-void AssetDumperXModel::AddXModelFaces(AbstractXModelWriter& writer, const DistinctMapper<Material*>& materialMapper, const XModel* model, const unsigned lod)
-{
-    const auto* surfs = &model->surfs[model->lodInfo[lod].surfIndex];
-    const auto surfCount = model->lodInfo[lod].numsurfs;
-    const auto baseSurfIndex = model->lodInfo[lod].surfIndex;
-
-    for (auto surfIndex = 0u; surfIndex < surfCount; surfIndex++)
-    {
-        const auto& surface = surfs[surfIndex];
-        for (auto triIndex = 0u; triIndex < surface.triCount; triIndex++)
-        {
-            const auto& tri = surface.triIndices[triIndex];
-
-            XModelFace face{};
-            face.vertexIndex[0] = tri[0] + surface.baseVertIndex;
-            face.vertexIndex[1] = tri[1] + surface.baseVertIndex;
-            face.vertexIndex[2] = tri[2] + surface.baseVertIndex;
-            face.objectIndex = static_cast<int>(surfIndex);
-            face.materialIndex = static_cast<int>(materialMapper.GetDistinctPositionByInputPosition(surfIndex + baseSurfIndex));
-            writer.AddFace(face);
-        }
-    }
-}
-
 void AssetDumperXModel::DumpXModelExportLod(const AssetDumpingContext& context, XAssetInfo<XModel>* asset, const unsigned lod)
 {
     const auto* model = asset->Asset();
@@ -601,26 +507,28 @@ void AssetDumperXModel::DumpXModelExportLod(const AssetDumpingContext& context,
 
     const auto writer = XModelExportWriter::CreateWriterForVersion6(context.m_zone->m_game->GetShortName(), context.m_zone->m_name);
     DistinctMapper<Material*> materialMapper(model->numsurfs);
-    XModelVertexBoneWeightCollection boneWeightCollection;
-    AllocateXModelBoneWeights(model, lod, boneWeightCollection);
 
     AddXModelBones(context, *writer, model);
     AddXModelMaterials(*writer, materialMapper, model);
     AddXModelObjects(*writer, model, lod);
-    AddXModelVertices(*writer, model, lod);
-    AddXModelVertexBoneWeights(*writer, model, lod, boneWeightCollection);
-    AddXModelFaces(*writer, materialMapper, model, lod);
 
+    const XModelLodSurfaceSource surfaceSource(&model->surfs[model->lodInfo[lod].surfIndex], model->lodInfo[lod].numsurfs, model->lodInfo[lod].surfIndex, materialMapper);
+    writer->SetSurfaceSource(&surfaceSource);
     writer->Write(*assetFile);
 }
 
-void AssetDumperXModel::DumpXModelExport(const AssetDumpingContext& context, XAssetInfo<XModel>* asset)
+void AssetDumperXModel::DumpXModelExport(AssetDumpingContext& context, XAssetInfo<XModel>* asset)
 {
+    auto* lodZoneState = context.GetZoneAssetDumperState<ModelLodDumpingZoneState>();
     const auto* model = asset->Asset();
     for (auto currentLod = 0u; currentLod < model->numLods; currentLod++)
     {
-        DumpXModelExportLod(context, asset, currentLod);
+        lodZoneState->DumpLod(GetLodVertexCount(model, currentLod), [&context, asset, currentLod]
+        {
+            DumpXModelExportLod(context, asset, currentLod);
+        });
     }
+    lodZoneState->WaitForLods();
 }
 
 void AssetDumperXModel::DumpAsset(AssetDumpingContext& context, XAssetInfo<XModel>* asset)
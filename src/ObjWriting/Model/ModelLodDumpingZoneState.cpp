@@ -0,0 +1,22 @@
+#include "ModelLodDumpingZoneState.h"
+
+#include "ObjWriting.h"
+
+ModelLodDumpingZoneState::ModelLodDumpingZoneState()
+{
+    const auto threadCount = ObjWriting::Configuration.ModelDumpThreadCount > 0
+                                 ? ObjWriting::Configuration.ModelDumpThreadCount
+                                 : TaskPool::DefaultThreadCount();
+
+    m_task_pool = std::make_unique<TaskPool>(threadCount, ObjWriting::Configuration.ModelDumpVertexBudget);
+}
+
+void ModelLodDumpingZoneState::DumpLod(const size_t vertexCount, std::function<void()> dumpLod)
+{
+    m_task_pool->Enqueue(std::move(dumpLod), vertexCount);
+}
+
+void ModelLodDumpingZoneState::WaitForLods()
+{
+    m_task_pool->WaitForCompletion();
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "Dumping/IZoneAssetDumperState.h"
+#include "Utils/TaskPool.h"
+
+/**
+ * \brief Dumps the lods of models concurrently.
+ * Each lod dump only reads the immutable model data and writes its own file, so lods of the same model can be dumped at the same time.
+ * The amount of vertices being dumped at once is limited by the configured budget to keep the memory usage in check.
+ */
+class ModelLodDumpingZoneState final : public IZoneAssetDumperState
+{
+    std::unique_ptr<TaskPool> m_task_pool;
+
+public:
+    ModelLodDumpingZoneState();
+
+    void DumpLod(size_t vertexCount, std::function<void()> dumpLod);
+    void WaitForLods();
+};
@@ -1,19 +1,123 @@
 #include "ObjWriter.h"
 
-#include "Game/IW4/CommonIW4.h"
+#include <charconv>
+#include <string_view>
+
+namespace
+{
+    /**
+     * \brief Collects text in a large buffer and hands it to the stream in few big writes instead of one call per value.
+     */
+    class ObjTextBuffer
+    {
+        static constexpr size_t FLUSH_SIZE = 0x100000;
+
+        std::ostream& m_stream;
+        std::string m_buffer;
+
+    public:
+        explicit ObjTextBuffer(std::ostream& stream)
+            : m_stream(stream)
+        {
+            m_buffer.reserve(FLUSH_SIZE + 0x100);
+        }
+
+        ~ObjTextBuffer()
+        {
+            Flush();
+        }
+
+        ObjTextBuffer(const ObjTextBuffer& other) = delete;
+        ObjTextBuffer(ObjTextBuffer&& other) noexcept = delete;
+        ObjTextBuffer& operator=(const ObjTextBuffer& other) = delete;
+        ObjTextBuffer& operator=(ObjTextBuffer&& other) noexcept = delete;
+
+        void Flush()
+        {
+            if (m_buffer.empty())
+                return;
+
+            m_stream.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+            m_buffer.clear();
+        }
+
+        void EndLine()
+        {
+            m_buffer.push_back('\n');
+
+            if (m_buffer.size() >= FLUSH_SIZE)
+                Flush();
+        }
+
+        ObjTextBuffer& operator<<(const std::string_view& str)
+        {
+            m_buffer.append(str);
+            return *this;
+        }
+
+        ObjTextBuffer& operator<<(const char c)
+        {
+            m_buffer.push_back(c);
+            return *this;
+        }
+
+        ObjTextBuffer& operator<<(const size_t value)
+        {
+            char buffer[32];
+            const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            m_buffer.append(buffer, result.ptr);
+            return *this;
+        }
+
+        ObjTextBuffer& operator<<(const float value)
+        {
+            // Same output as the default formatting of ostreams
+            char buffer[32];
+            const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, 6);
+            m_buffer.append(buffer, result.ptr);
+            return *this;
+        }
+    };
+}
 
 ObjWriter::ObjWriter(std::string gameName, std::string zoneName)
     : m_game_name(std::move(gameName)),
-      m_zone_name(std::move(zoneName))
+      m_zone_name(std::move(zoneName)),
+      m_written_object_count(0u),
+      m_written_distinct_offsets{}
 {
 }
 
+ObjWriter::ObjObjectData* ObjWriter::GetObjectData(const int objectId)
+{
+    if (objectId < 0 || static_cast<unsigned>(objectId) < m_written_object_count)
+        return nullptr;
+
+    const auto objectDataIndex = static_cast<unsigned>(objectId) - m_written_object_count;
+    if (objectDataIndex >= m_object_data.size())
+        return nullptr;
+
+    return &m_object_data[objectDataIndex];
+}
+
 void ObjWriter::AddObject(ObjObject object)
 {
     m_objects.emplace_back(std::move(object));
     m_object_data.emplace_back();
 }
 
+void ObjWriter::ReserveObjectData(const int objectId, const size_t vertexCount, const size_t faceCount)
+{
+    auto* objectData = GetObjectData(objectId);
+    if (!objectData)
+        return;
+
+    objectData->m_vertices.Reserve(vertexCount);
+    objectData->m_normals.Reserve(vertexCount);
+    objectData->m_uvs.Reserve(vertexCount);
+    objectData->m_faces.reserve(faceCount);
+}
+
 void ObjWriter::AddMaterial(MtlMaterial material)
 {
     m_materials.emplace_back(std::move(material));
@@ -21,139 +125,182 @@ void ObjWriter::AddMaterial(MtlMaterial material)
 
 void ObjWriter::AddVertex(const int objectId, const ObjVertex vertex)
 {
-    if (objectId < 0 || static_cast<unsigned>(objectId) >= m_object_data.size())
+    auto* objectData = GetObjectData(objectId);
+    if (!objectData)
         return;
 
-    m_object_data[objectId].m_vertices.Add(vertex);
+    objectData->m_vertices.Add(vertex);
 }
 
 void ObjWriter::AddNormal(const int objectId, const ObjNormal normal)
 {
-    if (objectId < 0 || static_cast<unsigned>(objectId) >= m_object_data.size())
+    auto* objectData = GetObjectData(objectId);
+    if (!objectData)
         return;
 
-    m_object_data[objectId].m_normals.Add(normal);
+    objectData->m_normals.Add(normal);
 }
 
 void ObjWriter::AddUv(const int objectId, const ObjUv uv)
 {
-    if (objectId < 0 || static_cast<unsigned>(objectId) >= m_object_data.size())
+    auto* objectData = GetObjectData(objectId);
+    if (!objectData)
         return;
 
-    m_object_data[objectId].m_uvs.Add(uv);
+    objectData->m_uvs.Add(uv);
 }
 
 void ObjWriter::AddFace(const int objectId, const ObjFace face)
 {
-    if (objectId < 0 || static_cast<unsigned>(objectId) >= m_object_data.size())
+    auto* objectData = GetObjectData(objectId);
+    if (!objectData)
         return;
 
-    m_object_data[objectId].m_faces.push_back(face);
+    objectData->m_faces.push_back(face);
 }
 
-void ObjWriter::GetObjObjectDataOffsets(std::vector<ObjObjectDataOffsets>& inputOffsets, std::vector<ObjObjectDataOffsets>& distinctOffsets)
+void ObjWriter::GetObjObjectDataOffsets(std::vector<ObjObjectDataOffsets>& distinctOffsets)
 {
-    ObjObjectDataOffsets currentInputOffsets{};
-    ObjObjectDataOffsets currentDistinctOffsets{};
+    auto currentDistinctOffsets = m_written_distinct_offsets;
+
+    distinctOffsets.reserve(m_object_data.size());
 
     for (const auto& objectData : m_object_data)
     {
-        inputOffsets.push_back(currentInputOffsets);
         distinctOffsets.push_back(currentDistinctOffsets);
 
-        currentInputOffsets.vertexOffset += objectData.m_vertices.GetInputValueCount();
-        currentInputOffsets.normalOffset += objectData.m_normals.GetInputValueCount();
-        currentInputOffsets.uvOffset += objectData.m_uvs.GetInputValueCount();
         currentDistinctOffsets.vertexOffset += objectData.m_vertices.GetDistinctValueCount();
         currentDistinctOffsets.normalOffset += objectData.m_normals.GetDistinctValueCount();
         currentDistinctOffsets.uvOffset += objectData.m_uvs.GetDistinctValueCount();
     }
-}
 
-void ObjWriter::WriteObj(std::ostream& stream)
-{
-    WriteObj(stream, std::string());
+    m_written_distinct_offsets = currentDistinctOffsets;
 }
 
-void ObjWriter::WriteObj(std::ostream& stream, const std::string& mtlName)
+void ObjWriter::WriteObjHeader(std::ostream& stream, const std::string& mtlName) const
 {
-    stream << "# OpenAssetTools OBJ File ( " << m_game_name << ")\n";
-    stream << "# Game Origin: " << m_game_name << "\n";
-    stream << "# Zone Origin: " << m_zone_name << "\n";
+    ObjTextBuffer buffer(stream);
+
+    buffer << "# OpenAssetTools OBJ File ( " << m_game_name << ")";
+    buffer.EndLine();
+    buffer << "# Game Origin: " << m_game_name;
+    buffer.EndLine();
+    buffer << "# Zone Origin: " << m_zone_name;
+    buffer.EndLine();
 
     if (!mtlName.empty())
-        stream << "mtllib " << mtlName << "\n";
+    {
+        buffer << "mtllib " << mtlName;
+        buffer.EndLine();
+    }
+}
 
-    std::vector<ObjObjectDataOffsets> inputOffsetsByObject;
+void ObjWriter::WriteObjObjects(std::ostream& stream)
+{
     std::vector<ObjObjectDataOffsets> distinctOffsetsByObject;
-    GetObjObjectDataOffsets(inputOffsetsByObject, distinctOffsetsByObject);
+    GetObjObjectDataOffsets(distinctOffsetsByObject);
+
+    ObjTextBuffer buffer(stream);
 
-    auto objectIndex = 0;
+    auto objectIndex = 0u;
     for (const auto& object : m_objects)
     {
         const auto& objectData = m_object_data[objectIndex];
-        stream << "o " << object.name << "\n";
+        const auto& distinctOffsets = distinctOffsetsByObject[objectIndex];
+
+        buffer << "o " << object.name;
+        buffer.EndLine();
 
         for (const auto& v : objectData.m_vertices.GetDistinctValues())
-            stream << "v " << v.coordinates[0] << " " << v.coordinates[1] << " " << v.coordinates[2] << "\n";
+        {
+            buffer << "v " << v.coordinates[0] << ' ' << v.coordinates[1] << ' ' << v.coordinates[2];
+            buffer.EndLine();
+        }
         for (const auto& uv : objectData.m_uvs.GetDistinctValues())
-            stream << "vt " << uv.uv[0] << " " << uv.uv[1] << "\n";
+        {
+            buffer << "vt " << uv.uv[0] << ' ' << uv.uv[1];
+            buffer.EndLine();
+        }
         for (const auto& n : objectData.m_normals.GetDistinctValues())
-            stream << "vn " << n.normal[0] << " " << n.normal[1] << " " << n.normal[2] << "\n";
+        {
+            buffer << "vn " << n.normal[0] << ' ' << n.normal[1] << ' ' << n.normal[2];
+            buffer.EndLine();
+        }
 
         if (object.materialIndex >= 0 && static_cast<unsigned>(object.materialIndex) < m_materials.size())
-            stream << "usemtl " << m_materials[object.materialIndex].materialName << "\n";
+        {
+            buffer << "usemtl " << m_materials[object.materialIndex].materialName;
+            buffer.EndLine();
+        }
 
         for (const auto& f : objectData.m_faces)
         {
-            const size_t v[3]
-            {
-                objectData.m_vertices.GetDistinctPositionByInputPosition(f.vertexIndex[0] - inputOffsetsByObject[objectIndex].vertexOffset) + distinctOffsetsByObject[objectIndex].vertexOffset + 1,
-                objectData.m_vertices.GetDistinctPositionByInputPosition(f.vertexIndex[1] - inputOffsetsByObject[objectIndex].vertexOffset) + distinctOffsetsByObject[objectIndex].vertexOffset + 1,
-                objectData.m_vertices.GetDistinctPositionByInputPosition(f.vertexIndex[2] - inputOffsetsByObject[objectIndex].vertexOffset) + distinctOffsetsByObject[objectIndex].vertexOffset + 1
-            };
-            const size_t n[3]
-            {
-                objectData.m_normals.GetDistinctPositionByInputPosition(f.normalIndex[0] - inputOffsetsByObject[objectIndex].normalOffset) + distinctOffsetsByObject[objectIndex].normalOffset + 1,
-                objectData.m_normals.GetDistinctPositionByInputPosition(f.normalIndex[1] - inputOffsetsByObject[objectIndex].normalOffset) + distinctOffsetsByObject[objectIndex].normalOffset + 1,
-                objectData.m_normals.GetDistinctPositionByInputPosition(f.normalIndex[2] - inputOffsetsByObject[objectIndex].normalOffset) + distinctOffsetsByObject[objectIndex].normalOffset + 1
-            };
-            const size_t uv[3]
+            buffer << 'f';
+            for (auto i = 0u; i < 3u; i++)
             {
-                objectData.m_uvs.GetDistinctPositionByInputPosition(f.uvIndex[0] - inputOffsetsByObject[objectIndex].uvOffset) + distinctOffsetsByObject[objectIndex].uvOffset + 1,
-                objectData.m_uvs.GetDistinctPositionByInputPosition(f.uvIndex[1] - inputOffsetsByObject[objectIndex].uvOffset) + distinctOffsetsByObject[objectIndex].uvOffset + 1,
-                objectData.m_uvs.GetDistinctPositionByInputPosition(f.uvIndex[2] - inputOffsetsByObject[objectIndex].uvOffset) + distinctOffsetsByObject[objectIndex].uvOffset + 1
-            };
+                const auto v = objectData.m_vertices.GetDistinctPositionByInputPosition(f.vertexIndex[i]) + distinctOffsets.vertexOffset + 1;
+                const auto uv = objectData.m_uvs.GetDistinctPositionByInputPosition(f.uvIndex[i]) + distinctOffsets.uvOffset + 1;
+                const auto n = objectData.m_normals.GetDistinctPositionByInputPosition(f.normalIndex[i]) + distinctOffsets.normalOffset + 1;
 
-            stream << "f " << v[0] << "/" << uv[0] << "/" << n[0]
-                << " " << v[1] << "/" << uv[1] << "/" << n[1]
-                << " " << v[2] << "/" << uv[2] << "/" << n[2]
-                << "\n";
+                buffer << ' ' << v << '/' << uv << '/' << n;
+            }
+            buffer.EndLine();
         }
 
         objectIndex++;
     }
+
+    m_written_object_count += m_objects.size();
+    m_objects.clear();
+    m_object_data.clear();
+}
+
+void ObjWriter::WriteObj(std::ostream& stream)
+{
+    WriteObj(stream, std::string());
+}
+
+void ObjWriter::WriteObj(std::ostream& stream, const std::string& mtlName)
+{
+    WriteObjHeader(stream, mtlName);
+    WriteObjObjects(stream);
 }
 
-void ObjWriter::WriteMtl(std::ostream& stream)
+void ObjWriter::WriteMtl(std::ostream& stream) const
 {
-    stream << "# OpenAssetTools MAT File ( " << m_game_name << ")\n";
-    stream << "# Game Origin: " << m_game_name << "\n";
-    stream << "# Zone Origin: " << m_zone_name << "\n";
-    stream << "# Material count: " << m_materials.size() << "\n";
+    ObjTextBuffer buffer(stream);
+
+    buffer << "# OpenAssetTools MAT File ( " << m_game_name << ")";
+    buffer.EndLine();
+    buffer << "# Game Origin: " << m_game_name;
+    buffer.EndLine();
+    buffer << "# Zone Origin: " << m_zone_name;
+    buffer.EndLine();
+    buffer << "# Material count: " << m_materials.size();
+    buffer.EndLine();
 
     for (const auto& material : m_materials)
     {
-        stream << "\n";
-        stream << "newmtl " << material.materialName << "\n";
+        buffer.EndLine();
+        buffer << "newmtl " << material.materialName;
+        buffer.EndLine();
 
         if (!material.colorMapName.empty())
-            stream << "map_Kd ../images/" << material.colorMapName << ".dds\n";
+        {
+            buffer << "map_Kd ../images/" << material.colorMapName << ".dds";
+            buffer.EndLine();
+        }
 
         if (!material.normalMapName.empty())
-            stream << "map_bump ../images/" << material.normalMapName << ".dds\n";
+        {
+            buffer << "map_bump ../images/" << material.normalMapName << ".dds";
+            buffer.EndLine();
+        }
 
         if (!material.specularMapName.empty())
-            stream << "map_Ks ../images/" << material.specularMapName << ".dds\n";
+        {
+            buffer << "map_Ks ../images/" << material.specularMapName << ".dds";
+            buffer.EndLine();
+        }
     }
 }
@@ -30,19 +30,39 @@ protected:
     std::vector<ObjObjectData> m_object_data;
     std::vector<MtlMaterial> m_materials;
 
-    void GetObjObjectDataOffsets(std::vector<ObjObjectDataOffsets>& inputOffsets, std::vector<ObjObjectDataOffsets>& distinctOffsets);
+    // Objects that have already been written are released, their ids and written values still count for objects that follow
+    size_t m_written_object_count;
+    ObjObjectDataOffsets m_written_distinct_offsets;
+
+    ObjObjectData* GetObjectData(int objectId);
+    void GetObjObjectDataOffsets(std::vector<ObjObjectDataOffsets>& distinctOffsets);
 
 public:
     ObjWriter(std::string gameName, std::string zoneName);
 
     void AddObject(ObjObject object);
+    void ReserveObjectData(int objectId, size_t vertexCount, size_t faceCount);
     void AddMaterial(MtlMaterial material);
     void AddVertex(int objectId, ObjVertex vertex);
     void AddNormal(int objectId, ObjNormal normal);
     void AddUv(int objectId, ObjUv uv);
+
+    /**
+     * \brief Adds a face to an object. The indices of the face are relative to the first vertex, normal and uv of the object.
+     */
     void AddFace(int objectId, ObjFace face);
 
+    /**
+     * \brief Writes the header of an obj file. Objects can then be written one after another with WriteObjObjects.
+     */
+    void WriteObjHeader(std::ostream& stream, const std::string& mtlName) const;
+
+    /**
+     * \brief Writes all objects that were added since the last call and releases their data.
+     */
+    void WriteObjObjects(std::ostream& stream);
+
     void WriteObj(std::ostream& stream);
     void WriteObj(std::ostream& stream, const std::string& mtlName);
-    void WriteMtl(std::ostream& stream);
+    void WriteMtl(std::ostream& stream) const;
 };
@@ -1,7 +1,9 @@
 #include "AbstractXModelWriter.h"
 
 AbstractXModelWriter::AbstractXModelWriter()
-= default;
+    : m_surface_source(nullptr)
+{
+}
 
 void AbstractXModelWriter::AddObject(XModelObject object)
 {
@@ -18,17 +20,7 @@ void AbstractXModelWriter::AddMaterial(XModelMaterial material)
     m_materials.emplace_back(std::move(material));
 }
 
-void AbstractXModelWriter::AddVertex(XModelVertex vertex)
-{
-    m_vertices.emplace_back(vertex);
-}
-
-void AbstractXModelWriter::AddVertexBoneWeights(XModelVertexBoneWeights vertexBoneWeights)
-{
-    m_vertex_bone_weights.emplace_back(vertexBoneWeights);
-}
-
-void AbstractXModelWriter::AddFace(XModelFace face)
+void AbstractXModelWriter::SetSurfaceSource(const IXModelSurfaceSource* surfaceSource)
 {
-    m_faces.emplace_back(face);
+    m_surface_source = surfaceSource;
 }
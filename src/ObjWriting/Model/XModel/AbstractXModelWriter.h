@@ -2,6 +2,7 @@
 
 #include <vector>
 
+#include "IXModelSurfaceSource.h"
 #include "Model/XModel/XModelCommon.h"
 
 class AbstractXModelWriter
@@ -10,9 +11,7 @@ protected:
     std::vector<XModelObject> m_objects;
     std::vector<XModelBone> m_bones;
     std::vector<XModelMaterial> m_materials;
-    std::vector<XModelVertex> m_vertices;
-    std::vector<XModelVertexBoneWeights> m_vertex_bone_weights;
-    std::vector<XModelFace> m_faces;
+    const IXModelSurfaceSource* m_surface_source;
 
 public:
     AbstractXModelWriter();
@@ -20,7 +19,10 @@ public:
     void AddObject(XModelObject object);
     void AddBone(XModelBone bone);
     void AddMaterial(XModelMaterial material);
-    void AddVertex(XModelVertex vertex);
-    void AddVertexBoneWeights(XModelVertexBoneWeights vertexBoneWeights);
-    void AddFace(XModelFace face);
+
+    /**
+     * \brief Sets the source the vertices, vertex weights and faces are read from while writing.
+     * The source is not owned by the writer and must stay alive until writing is done.
+     */
+    void SetSurfaceSource(const IXModelSurfaceSource* surfaceSource);
 };
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Utils/ClassUtils.h"
+#include "Model/XModel/XModelCommon.h"
+
+/**
+ * \brief Provides the geometry of a model lod surface by surface.
+ * Writers pull the data of one surface at a time into buffers they reuse, so the vertices, weights and faces of a whole lod never have to be held in memory at once.
+ * Face vertex indices are relative to the first vertex of their surface.
+ */
+class IXModelSurfaceSource
+{
+public:
+    IXModelSurfaceSource() = default;
+    virtual ~IXModelSurfaceSource() = default;
+    IXModelSurfaceSource(const IXModelSurfaceSource& other) = default;
+    IXModelSurfaceSource(IXModelSurfaceSource&& other) noexcept = default;
+    IXModelSurfaceSource& operator=(const IXModelSurfaceSource& other) = default;
+    IXModelSurfaceSource& operator=(IXModelSurfaceSource&& other) noexcept = default;
+
+    _NODISCARD virtual size_t GetSurfaceCount() const = 0;
+    _NODISCARD virtual size_t GetSurfaceVertexCount(size_t surfaceIndex) const = 0;
+    _NODISCARD virtual size_t GetSurfaceFaceCount(size_t surfaceIndex) const = 0;
+
+    virtual void ReadSurfaceVertices(size_t surfaceIndex, std::vector<XModelVertex>& vertices) const = 0;
+    virtual void ReadSurfaceVertexBoneWeights(size_t surfaceIndex, std::vector<XModelVertexBoneWeights>& vertexBoneWeights) const = 0;
+    virtual void ReadSurfaceFaces(size_t surfaceIndex, std::vector<XModelFace>& faces) const = 0;
+};
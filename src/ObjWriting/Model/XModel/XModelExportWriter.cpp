@@ -11,35 +11,75 @@ protected:
     std::string m_game_name;
     std::string m_zone_name;
 
+    // Vertices are merged across the whole lod, so only the distinct vertices are kept while writing.
+    // The remaining data of a surface is read again when writing its faces instead.
     VertexMerger m_vertex_merger;
+    std::vector<size_t> m_surface_vertex_offsets;
 
-    void PrepareVertexMerger()
+    void ReadSurfaceVertexPositions(const size_t surfaceIndex, std::vector<XModelVertex>& vertices, std::vector<XModelVertexBoneWeights>& vertexBoneWeights,
+                                    std::vector<VertexMergerPos>& positions) const
     {
-        m_vertex_merger = VertexMerger(m_vertices.size());
+        vertices.clear();
+        vertexBoneWeights.clear();
+        positions.clear();
+        m_surface_source->ReadSurfaceVertices(surfaceIndex, vertices);
+        m_surface_source->ReadSurfaceVertexBoneWeights(surfaceIndex, vertexBoneWeights);
 
+        positions.reserve(vertices.size());
         auto vertexOffset = 0u;
-        for (const auto& vertex : m_vertices)
+        for (const auto& vertex : vertices)
         {
-            XModelVertexBoneWeights weights{
-                nullptr,
-                0
-            };
-
-            if(vertexOffset < m_vertex_bone_weights.size())
-                weights = m_vertex_bone_weights[vertexOffset];
-
-            m_vertex_merger.Add(VertexMergerPos{
+            VertexMergerPos pos{
                 vertex.coordinates[0],
                 vertex.coordinates[1],
                 vertex.coordinates[2],
-                weights.weights,
-                weights.weightCount
-            });
+                XModelVertexBoneWeights{}
+            };
+
+            if (vertexOffset < vertexBoneWeights.size())
+                pos.boneWeights = vertexBoneWeights[vertexOffset];
 
+            positions.emplace_back(pos);
             vertexOffset++;
         }
     }
 
+    void MergeVertices()
+    {
+        m_surface_vertex_offsets.clear();
+
+        if (!m_surface_source)
+        {
+            m_vertex_merger = VertexMerger();
+            return;
+        }
+
+        const auto surfaceCount = m_surface_source->GetSurfaceCount();
+        size_t vertexCount = 0u;
+        for (auto surfaceIndex = 0u; surfaceIndex < surfaceCount; surfaceIndex++)
+            vertexCount += m_surface_source->GetSurfaceVertexCount(surfaceIndex);
+
+        m_vertex_merger = VertexMerger(vertexCount);
+        m_surface_vertex_offsets.reserve(surfaceCount);
+
+        std::vector<XModelVertex> vertices;
+        std::vector<XModelVertexBoneWeights> vertexBoneWeights;
+        std::vector<VertexMergerPos> positions;
+        for (auto surfaceIndex = 0u; surfaceIndex < surfaceCount; surfaceIndex++)
+        {
+            ReadSurfaceVertexPositions(surfaceIndex, vertices, vertexBoneWeights, positions);
+
+            m_surface_vertex_offsets.push_back(m_vertex_merger.GetInputValueCount());
+            for (const auto& pos : positions)
+                m_vertex_merger.Add(pos);
+        }
+    }
+
+    _NODISCARD size_t GetDistinctVertex(const size_t surfaceIndex, const size_t vertexIndex) const
+    {
+        return m_vertex_merger.GetDistinctPositionByInputPosition(m_surface_vertex_offsets[surfaceIndex] + vertexIndex);
+    }
+
     void WriteHeader(std::ostream& stream, const int version) const
     {
         stream << "// OpenAssetTools XMODEL_EXPORT File\n";
@@ -105,6 +145,23 @@ protected:
 
 class XModelExportWriter6 final : public XModelExportWriterBase
 {
+    static void WriteVertex(std::ostream& stream, const size_t index, const VertexMergerPos& vertexPos)
+    {
+        stream << "VERT " << index << "\n";
+        stream << "OFFSET ";
+        stream << std::setprecision(6) << std::fixed << vertexPos.x
+            << ", " << std::setprecision(6) << std::fixed << vertexPos.y
+            << ", " << std::setprecision(6) << std::fixed << vertexPos.z << "\n";
+        stream << "BONES " << vertexPos.boneWeights.weightCount << "\n";
+
+        for (auto weightIndex = 0u; weightIndex < vertexPos.boneWeights.weightCount; weightIndex++)
+        {
+            stream << "BONE " << vertexPos.boneWeights.weights[weightIndex].boneIndex
+                << " " << std::setprecision(6) << std::fixed << vertexPos.boneWeights.weights[weightIndex].weight << "\n";
+        }
+        stream << "\n";
+    }
+
     void WriteVertices(std::ostream& stream) const
     {
         const auto& distinctVertexValues = m_vertex_merger.GetDistinctValues();
@@ -112,19 +169,7 @@ class XModelExportWriter6 final : public XModelExportWriterBase
         size_t vertexNum = 0u;
         for (const auto& vertexPos : distinctVertexValues)
         {
-            stream << "VERT " << vertexNum << "\n";
-            stream << "OFFSET ";
-            stream << std::setprecision(6) << std::fixed << vertexPos.x
-                << ", " << std::setprecision(6) << std::fixed << vertexPos.y
-                << ", " << std::setprecision(6) << std::fixed << vertexPos.z << "\n";
-            stream << "BONES " << vertexPos.weightCount << "\n";
-
-            for (auto weightIndex = 0u; weightIndex < vertexPos.weightCount; weightIndex++)
-            {
-                stream << "BONE " << vertexPos.weights[weightIndex].boneIndex
-                    << " " << std::setprecision(6) << std::fixed << vertexPos.weights[weightIndex].weight << "\n";
-            }
-            stream << "\n";
+            WriteVertex(stream, vertexNum, vertexPos);
             vertexNum++;
         }
     }
@@ -145,25 +190,47 @@ class XModelExportWriter6 final : public XModelExportWriterBase
 
     void WriteFaces(std::ostream& stream) const
     {
-        stream << "NUMFACES " << m_faces.size() << "\n";
-        for (const auto& face : m_faces)
+        if (!m_surface_source)
+        {
+            stream << "NUMFACES 0\n";
+            return;
+        }
+
+        const auto surfaceCount = m_surface_source->GetSurfaceCount();
+        size_t faceCount = 0u;
+        for (auto surfaceIndex = 0u; surfaceIndex < surfaceCount; surfaceIndex++)
+            faceCount += m_surface_source->GetSurfaceFaceCount(surfaceIndex);
+
+        stream << "NUMFACES " << faceCount << "\n";
+
+        std::vector<XModelVertex> vertices;
+        std::vector<XModelFace> faces;
+        for (auto surfaceIndex = 0u; surfaceIndex < surfaceCount; surfaceIndex++)
         {
-            const size_t distinctPositions[3]
+            vertices.clear();
+            faces.clear();
+            m_surface_source->ReadSurfaceVertices(surfaceIndex, vertices);
+            m_surface_source->ReadSurfaceFaces(surfaceIndex, faces);
+
+            for (const auto& face : faces)
             {
-                m_vertex_merger.GetDistinctPositionByInputPosition(face.vertexIndex[0]),
-                m_vertex_merger.GetDistinctPositionByInputPosition(face.vertexIndex[1]),
-                m_vertex_merger.GetDistinctPositionByInputPosition(face.vertexIndex[2])
-            };
+                const size_t distinctPositions[3]
+                {
+                    GetDistinctVertex(surfaceIndex, face.vertexIndex[0]),
+                    GetDistinctVertex(surfaceIndex, face.vertexIndex[1]),
+                    GetDistinctVertex(surfaceIndex, face.vertexIndex[2])
+                };
 
-            const XModelVertex& v0 = m_vertices[face.vertexIndex[0]];
-            const XModelVertex& v1 = m_vertices[face.vertexIndex[1]];
-            const XModelVertex& v2 = m_vertices[face.vertexIndex[2]];
+                const XModelVertex& v0 = vertices[face.vertexIndex[0]];
+                const XModelVertex& v1 = vertices[face.vertexIndex[1]];
+                const XModelVertex& v2 = vertices[face.vertexIndex[2]];
 
-            stream << "TRI " << face.objectIndex << " " << face.materialIndex << " 0 0\n";
-            WriteFaceVertex(stream, distinctPositions[0], v0);
-            WriteFaceVertex(stream, distinctPositions[1], v1);
-            WriteFaceVertex(stream, distinctPositions[2], v2);
-            stream << "\n";
+                stream << "TRI " << face.objectIndex << " " << face.materialIndex << " 0 0\n";
+                WriteFaceVertex(stream, distinctPositions[0], v0);
+                WriteFaceVertex(stream, distinctPositions[1], v1);
+                WriteFaceVertex(stream, distinctPositions[2], v2);
+                stream << "\n";
+            }
         }
     }
 
@@ -235,7 +302,7 @@ public:
 
     void Write(std::ostream& stream) override
     {
-        PrepareVertexMerger();
+        MergeVertices();
         WriteHeader(stream, 6);
         WriteBones(stream);
         WriteVertices(stream);
@@ -30,6 +30,11 @@ public:
         ModelOutputFormat_e ModelOutputFormat = ModelOutputFormat_e::XMODEL_EXPORT;
         bool MenuLegacyMode = false;
 
+        // 0 uses one thread per hardware thread
+        unsigned ModelDumpThreadCount = 0;
+        // Maximum amount of vertices of model lods that are dumped at the same time, 0 for no limit
+        size_t ModelDumpVertexBudget = 4000000;
+
     } Configuration;
 
     static bool DumpZone(AssetDumpingContext& context);
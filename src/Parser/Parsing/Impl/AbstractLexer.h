@@ -2,7 +2,9 @@
 
 #include <cassert>
 #include <deque>
+#include <memory>
 #include <sstream>
+#include <string_view>
 
 #include "Utils/ClassUtils.h"
 #include "Parsing/ILexer.h"
@@ -17,35 +19,122 @@ class AbstractLexer : public ILexer<TokenType>
     static_assert(std::is_base_of<IParserValue, TokenType>::value);
 
 protected:
+    /**
+     * \brief A line of the input. Its text is stored inside the input buffer of the lexer.
+     */
+    class LexerLine
+    {
+    public:
+        std::shared_ptr<std::string> m_filename;
+        int m_line_number;
+        size_t m_input_offset;
+        size_t m_length;
+
+        _NODISCARD bool IsEof() const
+        {
+            return m_line_number <= 0;
+        }
+    };
+
+    /**
+     * \brief A view on a line of the input. Only valid until more input is read.
+     */
+    class LexerLineView
+    {
+    public:
+        const std::string* m_filename;
+        int m_line_number;
+        std::string_view m_line;
+    };
+
+    // Consumed input at the start of the buffer is only discarded once it makes up a good part of it to keep moving the remaining input cheap
+    static constexpr size_t MIN_DISCARD_SIZE = 0x10000;
+
     std::deque<TokenType> m_token_cache;
-    std::deque<ParserLine> m_line_cache;
     IParserLineStream* const m_stream;
+    bool m_read_whole_input;
+
+    // All cached lines one after another, each followed by a line break.
+    // The input offset of a line minus the buffer offset is its position in the buffer.
+    std::string m_buffer;
+    size_t m_buffer_offset;
+    std::deque<LexerLine> m_lines;
 
     unsigned m_line_index;
     unsigned m_current_line_offset;
+    size_t m_current_line_start;
+    size_t m_current_line_length;
 
     explicit AbstractLexer(IParserLineStream* stream)
         : m_stream(stream),
+          m_read_whole_input(false),
+          m_buffer_offset(0u),
           m_line_index(0u),
-          m_current_line_offset(0u)
+          m_current_line_offset(0u),
+          m_current_line_start(0u),
+          m_current_line_length(0u)
     {
     }
 
     virtual TokenType GetNextToken() = 0;
 
+    /**
+     * \brief Reads the next line of the stream into the buffer. When reading the whole input it reads all lines until the end instead.
+     */
+    void ReadLines()
+    {
+        do
+        {
+            auto line = m_stream->NextLine();
+            m_lines.push_back(LexerLine{std::move(line.m_filename), line.m_line_number, m_buffer_offset + m_buffer.size(), line.m_line.size()});
+            m_buffer.append(line.m_line);
+            m_buffer.push_back('\n');
+        } while (m_read_whole_input && !m_lines.back().IsEof());
+    }
+
+    void UpdateCurrentLine()
+    {
+        if (m_line_index < m_lines.size())
+        {
+            const auto& line = m_lines[m_line_index];
+            m_current_line_start = line.m_input_offset - m_buffer_offset;
+            m_current_line_length = line.m_length;
+        }
+        else
+        {
+            m_current_line_start = 0u;
+            m_current_line_length = 0u;
+        }
+    }
+
+    void DiscardConsumedInput()
+    {
+        const auto firstKeptOffset = m_lines.empty() ? m_buffer_offset + m_buffer.size() : m_lines.front().m_input_offset;
+        const auto discardSize = firstKeptOffset - m_buffer_offset;
+        if (discardSize < MIN_DISCARD_SIZE || discardSize < m_buffer.size() / 2)
+            return;
+
+        m_buffer.erase(0, discardSize);
+        m_buffer_offset = firstKeptOffset;
+        UpdateCurrentLine();
+    }
+
     int NextChar()
     {
+        if (m_current_line_offset < m_current_line_length)
+            return m_buffer[m_current_line_start + m_current_line_offset++];
+
         while (true)
         {
-            while (m_line_index >= m_line_cache.size())
+            while (m_line_index >= m_lines.size())
             {
-                if (!m_line_cache.empty() && m_line_cache.back().IsEof())
+                if (!m_lines.empty() && m_lines.back().IsEof())
                     return EOF;
 
-                m_line_cache.push_back(m_stream->NextLine());
+                ReadLines();
             }
 
-            if (m_current_line_offset >= m_line_cache[m_line_index].m_line.size())
+            if (m_current_line_offset >= m_lines[m_line_index].m_length)
             {
                 m_line_index++;
                 m_current_line_offset = 0;
@@ -54,44 +143,69 @@ protected:
                 break;
         }
 
-        return m_line_cache[m_line_index].m_line[m_current_line_offset++];
+        UpdateCurrentLine();
+        return m_buffer[m_current_line_start + m_current_line_offset++];
     }
 
-    int PeekChar()
+    /**
+     * \brief Finds the line that contains the next character, reading more lines if necessary.
+     * \param peekLine The index of the line containing the next character or of the last line if there are no more characters.
+     * \param peekLineOffset The offset of the next character inside its line.
+     * \return \c true if there is a next character, \c false if the end of the input was reached.
+     */
+    bool FindNextCharacter(unsigned& peekLine, unsigned& peekLineOffset)
     {
-        auto peekLineOffset = m_current_line_offset;
-        auto peekLine = m_line_index;
+        peekLineOffset = m_current_line_offset;
+        peekLine = m_line_index;
 
         while (true)
         {
-            while (peekLine >= m_line_cache.size())
+            while (peekLine >= m_lines.size())
             {
-                if (!m_line_cache.empty() && m_line_cache.back().IsEof())
-                    return EOF;
+                if (!m_lines.empty() && m_lines.back().IsEof())
+                {
+                    peekLine = static_cast<unsigned>(m_lines.size() - 1u);
+                    return false;
+                }
 
-                m_line_cache.push_back(m_stream->NextLine());
+                ReadLines();
             }
 
-            if (peekLineOffset >= m_line_cache[peekLine].m_line.size())
+            if (peekLineOffset >= m_lines[peekLine].m_length)
             {
                 peekLine++;
                 peekLineOffset = 0;
             }
             else
-                break;
+                return true;
         }
+    }
+
+    int PeekChar()
+    {
+        if (m_current_line_offset < m_current_line_length)
+            return m_buffer[m_current_line_start + m_current_line_offset];
+
+        unsigned peekLine, peekLineOffset;
+        if (!FindNextCharacter(peekLine, peekLineOffset))
+            return EOF;
 
-        return m_line_cache[peekLine].m_line[peekLineOffset];
+        return m_buffer[m_lines[peekLine].m_input_offset - m_buffer_offset + peekLineOffset];
     }
 
-    _NODISCARD const ParserLine& CurrentLine() const
+    _NODISCARD LexerLineView GetLineView(const LexerLine& line) const
     {
-        return m_line_cache[m_line_index];
+        return LexerLineView{line.m_filename.get(), line.m_line_number, std::string_view(&m_buffer[line.m_input_offset - m_buffer_offset], line.m_length)};
+    }
+
+    _NODISCARD LexerLineView CurrentLine() const
+    {
+        return GetLineView(m_lines[m_line_index]);
     }
 
     _NODISCARD bool IsLineEnd() const
     {
-        return m_current_line_offset >= CurrentLine().m_line.size();
+        return m_current_line_offset >= m_lines[m_line_index].m_length;
     }
 
     _NODISCARD bool NextCharInLineIs(const char c)
@@ -101,27 +215,36 @@ protected:
 
     _NODISCARD TokenPos GetPreviousCharacterPos() const
     {
-        const auto& currentLine = CurrentLine();
+        const auto& currentLine = m_lines[m_line_index];
         return TokenPos(*currentLine.m_filename, currentLine.m_line_number, m_current_line_offset);
     }
 
     _NODISCARD TokenPos GetNextCharacterPos()
     {
-        const auto& currentLine = CurrentLine();
-        if (m_current_line_offset + 1 >= currentLine.m_line.size())
+        const auto& currentLine = m_lines[m_line_index];
+        if (m_current_line_offset + 1 >= currentLine.m_length)
         {
-            PeekChar();
-            return TokenPos(*m_line_cache.back().m_filename, m_line_cache.back().m_line_number, 1);
+            unsigned peekLine, peekLineOffset;
+            if (!FindNextCharacter(peekLine, peekLineOffset))
+                return TokenPos();
+
+            const auto& nextLine = m_lines[peekLine];
+            return TokenPos(*nextLine.m_filename, nextLine.m_line_number, static_cast<int>(peekLineOffset + 1));
         }
 
         return TokenPos(*currentLine.m_filename, currentLine.m_line_number, m_current_line_offset + 1);
     }
 
+    _NODISCARD static bool IsLineOfPos(const LexerLine& line, const TokenPos& pos)
+    {
+        return line.m_line_number == pos.m_line && (line.m_filename.get() == &pos.m_filename.get() || *line.m_filename == pos.m_filename.get());
+    }
+
     /**
      * \brief Reads an identifier from the current position
-     * \return The value of the read identifier
+     * \return A view on the read identifier inside the current line
      */
-    std::string ReadIdentifier()
+    std::string_view ReadIdentifierView()
     {
         const auto& currentLine = CurrentLine();
         assert(m_current_line_offset >= 1);
@@ -139,7 +262,16 @@ protected:
             m_current_line_offset++;
         }
 
-        return std::string(currentLine.m_line, startPos, m_current_line_offset - startPos);
+        return std::string_view(currentLine.m_line).substr(startPos, m_current_line_offset - startPos);
+    }
+
+    /**
+     * \brief Reads an identifier from the current position
+     * \return The value of the read identifier
+     */
+    std::string ReadIdentifier()
+    {
+        return std::string(ReadIdentifierView());
     }
 
     /**
@@ -189,10 +321,10 @@ protected:
     }
 
     /**
-     * \brief Reads an identifier from the current position
-     * \return The value of the read identifier
+     * \brief Reads a string from the current position
+     * \return A view on the read string without quotation marks inside the current line
      */
-    std::string ReadString()
+    std::string_view ReadStringView()
     {
         const auto& currentLine = CurrentLine();
         assert(m_current_line_offset >= 1);
@@ -211,13 +343,22 @@ protected:
             m_current_line_offset++;
         }
 
-        return std::string(currentLine.m_line, startPos, m_current_line_offset++ - startPos);
+        return std::string_view(currentLine.m_line).substr(startPos, m_current_line_offset++ - startPos);
+    }
+
+    /**
+     * \brief Reads a string from the current position
+     * \return The value of the read string
+     */
+    std::string ReadString()
+    {
+        return std::string(ReadStringView());
     }
 
     void ReadHexNumber(int& integerValue)
     {
         const auto& currentLine = CurrentLine();
-        const auto* start = &currentLine.m_line.c_str()[m_current_line_offset - 1];
+        const auto* start = &currentLine.m_line.data()[m_current_line_offset - 1];
         char* end;
 
         integerValue = static_cast<int>(std::strtoul(start, &end, 16));
@@ -231,7 +372,7 @@ protected:
     _NODISCARD bool IsIntegerNumber() const
     {
         const auto& currentLine = CurrentLine();
-        const auto* currentCharacter = &currentLine.m_line.c_str()[m_current_line_offset - 1];
+        const auto* currentCharacter = &currentLine.m_line.data()[m_current_line_offset - 1];
         auto isInteger = true;
         auto dot = false;
         auto exponent = false;
@@ -278,7 +419,7 @@ protected:
     int ReadInteger()
     {
         const auto& currentLine = CurrentLine();
-        const auto* start = &currentLine.m_line.c_str()[m_current_line_offset - 1];
+        const auto* start = &currentLine.m_line.data()[m_current_line_offset - 1];
         char* end;
         const auto integerValue = std::strtol(start, &end, 10);
         const auto numberLength = static_cast<unsigned>(end - start);
@@ -294,7 +435,7 @@ protected:
     double ReadFloatingPoint()
     {
         const auto& currentLine = CurrentLine();
-        const auto* start = &currentLine.m_line.c_str()[m_current_line_offset - 1];
+        const auto* start = &currentLine.m_line.data()[m_current_line_offset - 1];
         char* end;
         const auto floatingPointValue = std::strtod(start, &end);
         const auto numberLength = static_cast<unsigned>(end - start);
@@ -363,7 +504,13 @@ public:
     const TokenType& GetToken(unsigned index) override
     {
         while (index >= m_token_cache.size())
+        {
+            // Peeking past the end of the input keeps returning the end of the input
+            if (!m_token_cache.empty() && m_token_cache.back().IsEof())
+                return m_token_cache.back();
+
             m_token_cache.emplace_back(GetNextToken());
+        }
 
         return m_token_cache[index];
     }
@@ -376,11 +523,9 @@ public:
         if (static_cast<int>(m_token_cache.size()) <= amount)
         {
             const auto& lastToken = m_token_cache.back();
-            while (!m_line_cache.empty()
-                && (m_line_cache.front().m_line_number != lastToken.GetPos().m_line
-                    || *m_line_cache.front().m_filename != lastToken.GetPos().m_filename.get()))
+            while (!m_lines.empty() && !IsLineOfPos(m_lines.front(), lastToken.GetPos()))
             {
-                m_line_cache.pop_front();
+                m_lines.pop_front();
                 m_line_index--;
             }
             m_token_cache.clear();
@@ -389,14 +534,14 @@ public:
         {
             m_token_cache.erase(m_token_cache.begin(), m_token_cache.begin() + amount);
             const auto& firstToken = m_token_cache.front();
-            while (!m_line_cache.empty()
-                && (m_line_cache.front().m_line_number != firstToken.GetPos().m_line
-                    || *m_line_cache.front().m_filename != firstToken.GetPos().m_filename.get()))
+            while (!m_lines.empty() && !IsLineOfPos(m_lines.front(), firstToken.GetPos()))
             {
-                m_line_cache.pop_front();
+                m_lines.pop_front();
                 m_line_index--;
             }
         }
+
+        DiscardConsumedInput();
     }
 
     _NODISCARD bool IsEof() override
@@ -411,13 +556,14 @@ public:
 
     _NODISCARD ParserLine GetLineForPos(const TokenPos& pos) const override
     {
-        for (const auto& line : m_line_cache)
+        for (const auto& line : m_lines)
         {
             if (line.m_filename
                 && *line.m_filename == pos.m_filename.get()
                 && line.m_line_number == pos.m_line)
             {
-                return line;
+                const auto lineView = GetLineView(line);
+                return ParserLine(line.m_filename, line.m_line_number, std::string(lineView.m_line));
             }
         }
 
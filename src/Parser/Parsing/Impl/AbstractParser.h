@@ -1,11 +1,13 @@
 #pragma once
 
 #include <iostream>
+#include <unordered_map>
 #include <vector>
 
 #include "Parsing/IParser.h"
 #include "Parsing/ILexer.h"
 #include "Parsing/Sequence/AbstractSequence.h"
+#include "Parsing/Sequence/SequenceDispatchIndex.h"
 #include "Parsing/ParsingException.h"
 
 template <typename TokenType, typename ParserState>
@@ -17,6 +19,25 @@ class AbstractParser : public IParser
 public:
     typedef AbstractSequence<TokenType, ParserState> sequence_t;
 
+private:
+    std::unordered_map<const std::vector<sequence_t*>*, SequenceDispatchIndex<TokenType, ParserState>> m_dispatch_indices;
+
+    const std::vector<sequence_t*>& GetTestsForToken(const TokenType& token)
+    {
+        const auto& stateTests = GetTestsForState();
+
+        int tokenType;
+        size_t tokenValue;
+        if (!GetFirstTokenKey(token, tokenType, tokenValue))
+            return stateTests;
+
+        auto foundIndex = m_dispatch_indices.find(&stateTests);
+        if (foundIndex == m_dispatch_indices.end())
+            foundIndex = m_dispatch_indices.emplace(&stateTests, SequenceDispatchIndex<TokenType, ParserState>(stateTests)).first;
+
+        return foundIndex->second.GetCandidates(tokenType, tokenValue);
+    }
+
 protected:
     ILexer<TokenType>* m_lexer;
     std::unique_ptr<ParserState> m_state;
@@ -29,6 +50,16 @@ protected:
 
     virtual const std::vector<sequence_t*>& GetTestsForState() = 0;
 
+    /**
+     * \brief Describes a token the same way the matchers of the parser describe the tokens they can start with.
+     * When implemented only the tests that can start with the next token are tried. This requires the tests of a state to not change while the parser exists.
+     * \return \c true if the token was described, \c false to always try all tests of a state.
+     */
+    virtual bool GetFirstTokenKey(const TokenType& /*token*/, int& /*type*/, size_t& /*value*/) const
+    {
+        return false;
+    }
+
 public:
     ~AbstractParser() override = default;
     AbstractParser(const AbstractParser& other) = default;
@@ -43,7 +74,7 @@ public:
             while (!m_lexer->IsEof())
             {
                 auto testSuccessful = false;
-                const auto& availableTests = GetTestsForState();
+                const auto& availableTests = GetTestsForToken(m_lexer->GetToken(0));
 
                 for (const sequence_t* test : availableTests)
                 {
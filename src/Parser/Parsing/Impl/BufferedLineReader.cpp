@@ -0,0 +1,76 @@
+#include "BufferedLineReader.h"
+
+#include <cstring>
+
+BufferedLineReader::BufferedLineReader(std::istream& stream)
+    : m_stream(stream),
+      m_position(0u),
+      m_end(0u),
+      m_stream_exhausted(false),
+      m_eof(false)
+{
+}
+
+bool BufferedLineReader::Refill()
+{
+    if (m_stream_exhausted)
+        return false;
+
+    // Keep the unfinished line at the start of the buffer and grow it if the line does not leave room for another chunk
+    if (m_position > 0u)
+    {
+        std::memmove(m_buffer.data(), &m_buffer[m_position], m_end - m_position);
+        m_end -= m_position;
+        m_position = 0u;
+    }
+
+    if (m_buffer.size() - m_end < CHUNK_SIZE)
+        m_buffer.resize(m_end + CHUNK_SIZE);
+
+    m_stream.read(&m_buffer[m_end], static_cast<std::streamsize>(m_buffer.size() - m_end));
+    const auto readCount = static_cast<size_t>(m_stream.gcount());
+    m_end += readCount;
+
+    if (!m_stream)
+        m_stream_exhausted = true;
+
+    return readCount > 0u;
+}
+
+bool BufferedLineReader::NextLine(std::string_view& line)
+{
+    auto searchStart = m_position;
+    while (true)
+    {
+        const auto* lineEnd = searchStart < m_end ? static_cast<const char*>(std::memchr(&m_buffer[searchStart], '\n', m_end - searchStart)) : nullptr;
+        if (lineEnd != nullptr)
+        {
+            const auto* lineStart = &m_buffer[m_position];
+            auto lineLength = static_cast<size_t>(lineEnd - lineStart);
+            if (lineLength > 0u && lineStart[lineLength - 1u] == '\r')
+                lineLength--;
+
+            line = std::string_view(lineStart, lineLength);
+            m_position += static_cast<size_t>(lineEnd - lineStart) + 1u;
+            return true;
+        }
+
+        const auto searchedCount = m_end - m_position;
+        if (!Refill())
+            break;
+        searchStart = m_position + searchedCount;
+    }
+
+    m_eof = true;
+    if (m_position >= m_end)
+        return false;
+
+    line = std::string_view(&m_buffer[m_position], m_end - m_position);
+    m_position = m_end;
+    return true;
+}
+
+bool BufferedLineReader::Eof() const
+{
+    return m_eof;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <istream>
+#include <string_view>
+#include <vector>
+
+#include "Utils/ClassUtils.h"
+
+/**
+ * \brief Reads lines from an input stream in large chunks instead of character by character.
+ * Lines are terminated by \n or \r\n. A \r that is not followed by \n stays part of the line.
+ */
+class BufferedLineReader
+{
+    static constexpr size_t CHUNK_SIZE = 0x10000;
+
+    std::istream& m_stream;
+    std::vector<char> m_buffer;
+    size_t m_position;
+    size_t m_end;
+    bool m_stream_exhausted;
+    bool m_eof;
+
+    bool Refill();
+
+public:
+    explicit BufferedLineReader(std::istream& stream);
+
+    /**
+     * \brief Reads the next line without its terminator.
+     * \param line The line that was read. It points into the buffer of the reader and is only valid until the next call.
+     * \return \c true if a line was read, \c false if there was no more data.
+     */
+    bool NextLine(std::string_view& line);
+
+    /**
+     * \brief Whether reading has reached the end of the data. Like for \c std::istream::eof this only is the case after a read encountered the end,
+     * so a line that ends with a line terminator directly before the end does not set it yet.
+     */
+    _NODISCARD bool Eof() const;
+};
@@ -32,30 +32,43 @@ DefinesStreamProxy::Define::Define(std::string name, std::string value)
 {
 }
 
+DefinesStreamProxy::DefineChange::DefineChange(const bool isUndefine, Define define)
+    : m_is_undefine(isUndefine),
+      m_define(std::move(define))
+{
+}
+
+DefinesStreamProxy::ActiveRecording::ActiveRecording(const size_t blockDepth, const size_t replayedLinesToSkip)
+    : m_block_depth(blockDepth),
+      m_replayed_lines_to_skip(replayedLinesToSkip),
+      m_can_be_replayed(true)
+{
+}
+
 std::string DefinesStreamProxy::Define::Render(const std::vector<std::string>& parameterValues) const
 {
     if (parameterValues.empty() || m_parameter_positions.empty())
         return m_value;
 
-    std::ostringstream str;
+    std::string result;
+    result.reserve(m_value.size());
+
     auto lastPos = 0u;
     for (const auto& parameterPosition : m_parameter_positions)
     {
         if (lastPos < parameterPosition.m_parameter_position)
-            str << std::string(m_value, lastPos, parameterPosition.m_parameter_position - lastPos);
+            result.append(m_value, lastPos, parameterPosition.m_parameter_position - lastPos);
 
         if (parameterPosition.m_parameter_index < parameterValues.size())
-        {
-            str << parameterValues[parameterPosition.m_parameter_index];
-        }
+            result.append(parameterValues[parameterPosition.m_parameter_index]);
 
         lastPos = parameterPosition.m_parameter_position;
     }
 
     if (lastPos < m_value.size())
-        str << std::string(m_value, lastPos, m_value.size() - lastPos);
+        result.append(m_value, lastPos, m_value.size() - lastPos);
 
-    return str.str();
+    return result;
 }
 
 void DefinesStreamProxy::Define::IdentifyParameters(const std::vector<std::string>& parameterNames)
@@ -124,8 +137,38 @@ DefinesStreamProxy::DefinesStreamProxy(IParserLineStream* stream, const bool ski
     : m_stream(stream),
       m_skip_directive_lines(skipDirectiveLines),
       m_ignore_depth(0),
-      m_in_define(false)
+      m_in_define(false),
+      m_defines_hash(0u),
+      m_has_pending_line(false)
+{
+}
+
+size_t DefinesStreamProxy::HashDefine(const Define& define)
+{
+    auto hash = std::hash<std::string>()(define.m_name);
+    const auto combine = [&hash](const size_t value)
+    {
+        hash ^= value + 0x9e3779b9u + (hash << 6) + (hash >> 2);
+    };
+
+    combine(std::hash<std::string>()(define.m_value));
+    for (const auto& parameterPosition : define.m_parameter_positions)
+    {
+        combine(parameterPosition.m_parameter_index);
+        combine(parameterPosition.m_parameter_position);
+    }
+
+    return hash;
+}
+
+void DefinesStreamProxy::OnBlockChanged()
 {
+    // Recordings that change a block that was opened before they started depend on more than the defines
+    for (auto& activeRecording : m_active_recordings)
+    {
+        if (m_modes.size() <= activeRecording.m_block_depth)
+            activeRecording.m_can_be_replayed = false;
+    }
 }
 
 int DefinesStreamProxy::GetLineEndEscapePos(const ParserLine& line)
@@ -269,10 +312,7 @@ bool DefinesStreamProxy::MatchUndefDirective(const ParserLine& line, const unsig
         throw ParsingException(CreatePos(line, currentPos), "Cannot undef without a name.");
 
     const auto name = line.m_line.substr(nameStartPos, currentPos - nameStartPos);
-    const auto entry = m_defines.find(name);
-
-    if (entry != m_defines.end())
-        m_defines.erase(entry);
+    Undefine(name);
 
     return true;
 }
@@ -339,6 +379,8 @@ bool DefinesStreamProxy::MatchElIfDirective(const ParserLine& line, const unsign
     if (m_modes.empty())
         throw ParsingException(CreatePos(line, currentPos), "Cannot use elif without if");
 
+    OnBlockChanged();
+
     if (m_modes.top() == BlockMode::BLOCK_BLOCKED)
         return true;
 
@@ -422,6 +464,8 @@ bool DefinesStreamProxy::MatchElseDirective(const ParserLine& line, const unsign
     if (m_modes.empty())
         throw ParsingException(CreatePos(line, currentPos), "Cannot use else without ifdef");
 
+    OnBlockChanged();
+
     m_modes.top() = m_modes.top() == BlockMode::NOT_IN_BLOCK ? BlockMode::IN_BLOCK : BlockMode::BLOCK_BLOCKED;
 
     return true;
@@ -443,11 +487,12 @@ bool DefinesStreamProxy::MatchEndifDirective(const ParserLine& line, const unsig
         return true;
     }
 
-    if (!m_modes.empty())
-        m_modes.pop();
-    else
+    if (m_modes.empty())
         throw ParsingException(CreatePos(line, currentPos), "Cannot use endif without ifdef");
 
+    OnBlockChanged();
+    m_modes.pop();
+
     return true;
 }
 
@@ -475,81 +520,6 @@ bool DefinesStreamProxy::MatchDirectives(const ParserLine& line)
         || MatchEndifDirective(line, directiveStartPos, directiveEndPos);
 }
 
-bool DefinesStreamProxy::FindDefineForWord(const ParserLine& line, const unsigned wordStart, const unsigned wordEnd, const Define*& value) const
-{
-    const std::string word(line.m_line, wordStart, wordEnd - wordStart);
-    const auto foundEntry = m_defines.find(word);
-    if (foundEntry != m_defines.end())
-    {
-        value = &foundEntry->second;
-        return true;
-    }
-
-    return false;
-}
-
-void DefinesStreamProxy::ExtractParametersFromDefineUsage(const ParserLine& line, const unsigned parameterStart, unsigned& parameterEnd, std::vector<std::string>& parameterValues)
-{
-    if (line.m_line[parameterStart] != '(')
-        return;
-
-    std::ostringstream currentValue;
-    auto pos = parameterStart + 1;
-    auto valueHasStarted = false;
-    auto parenthesisDepth = 0;
-    while (true)
-    {
-        if (pos >= line.m_line.size())
-            throw ParsingException(CreatePos(line, pos), "Invalid use of define");
-
-        const auto c = line.m_line[pos];
-
-        if (c == ',')
-        {
-            if (parenthesisDepth > 0)
-            {
-                valueHasStarted = true;
-                currentValue << c;
-            }
-            else
-            {
-                parameterValues.emplace_back(currentValue.str());
-                currentValue.clear();
-                currentValue.str(std::string());
-                valueHasStarted = false;
-            }
-        }
-        else if (c == '(')
-        {
-            valueHasStarted = true;
-            parenthesisDepth++;
-            currentValue << c;
-        }
-        else if (c == ')')
-        {
-            if (parenthesisDepth > 0)
-            {
-                valueHasStarted = true;
-                parenthesisDepth--;
-                currentValue << c;
-            }
-            else
-            {
-                parameterValues.emplace_back(currentValue.str());
-                parameterEnd = pos + 1;
-                break;
-            }
-        }
-        else if (valueHasStarted || !isspace(c))
-        {
-            valueHasStarted = true;
-            currentValue << c;
-        }
-
-        pos++;
-    }
-}
-
 bool DefinesStreamProxy::MatchDefinedExpression(const ParserLine& line, unsigned& pos, std::string& definitionName)
 {
     unsigned currentPos = pos;
@@ -601,119 +571,382 @@ void DefinesStreamProxy::ExpandDefinedExpressions(ParserLine& line) const
     }
 }
 
-void DefinesStreamProxy::ExpandDefines(ParserLine& line) const
+namespace
 {
-    bool usesDefines;
-    auto defineIterations = 0u;
+    bool IsWordStartCharacter(const char c)
+    {
+        return isalpha(static_cast<unsigned char>(c)) || c == '_';
+    }
 
-    do
+    bool IsWordCharacter(const char c)
     {
-        if (defineIterations > MAX_DEFINE_ITERATIONS)
-            throw ParsingException(CreatePos(line, 1), "Potential define loop? Exceeded max define iterations of " + std::to_string(MAX_DEFINE_ITERATIONS) + " iterations.");
+        return isalnum(static_cast<unsigned char>(c)) || c == '_';
+    }
+}
+
+/**
+ * \brief Expands all defines of a line in a single pass.
+ * Substituted text is put in front of the input that is still to be scanned, so only the substituted text is scanned again instead of the whole line.
+ * Every character remembers the defines that produced it (its hide set). A define is not expanded again inside of text that originates from its own value,
+ * parameter values keep the hide set they had at the usage of the define.
+ */
+class DefinesStreamProxy::DefineExpander
+{
+    static constexpr size_t EMPTY_HIDE_SET = 0u;
 
-        usesDefines = false;
+    class HideSet
+    {
+    public:
+        const Define* m_define;
+        size_t m_parent;
+    };
 
-        auto wordStart = 0u;
-        auto lastWordEnd = 0u;
-        auto inWord = false;
-        const Define* value;
-        std::ostringstream str;
+    class CharacterOrigin
+    {
+    public:
+        size_t m_hide_set;
+        unsigned m_depth;
+    };
 
-        for (auto i = 0u; i < line.m_line.size(); i++)
+    class ParameterValue
+    {
+    public:
+        std::string m_value;
+        std::vector<CharacterOrigin> m_origins;
+    };
+
+    const std::unordered_map<std::string, Define>& m_defines;
+    ParserLine& m_line;
+
+    std::vector<HideSet> m_hide_sets;
+
+    // The input that is still to be scanned is stored in reverse to be able to put substituted text in front of it in constant time
+    std::string m_pending;
+    std::vector<CharacterOrigin> m_pending_origins;
+
+    std::string m_result;
+    std::string m_word;
+    std::vector<ParameterValue> m_parameter_values;
+    size_t m_parameter_count;
+    std::string m_replacement;
+    std::vector<CharacterOrigin> m_replacement_origins;
+
+    void PopPending()
+    {
+        m_pending.pop_back();
+        m_pending_origins.pop_back();
+    }
+
+    _NODISCARD bool IsHidden(size_t hideSet, const Define* define) const
+    {
+        while (hideSet != EMPTY_HIDE_SET)
         {
-            const auto c = line.m_line[i];
-            if (!inWord)
-            {
-                if (isalpha(c) || c == '_')
-                {
-                    wordStart = i;
-                    inWord = true;
-                }
-            }
-            else
+            const auto& currentHideSet = m_hide_sets[hideSet];
+            if (currentHideSet.m_define == define)
+                return true;
+
+            hideSet = currentHideSet.m_parent;
+        }
+
+        return false;
+    }
+
+    ParameterValue& NextParameterValue()
+    {
+        if (m_parameter_count >= m_parameter_values.size())
+            m_parameter_values.emplace_back();
+
+        auto& parameterValue = m_parameter_values[m_parameter_count++];
+        parameterValue.m_value.clear();
+        parameterValue.m_origins.clear();
+
+        return parameterValue;
+    }
+
+    void ExtractParameters()
+    {
+        m_parameter_count = 0u;
+        if (m_pending.empty() || m_pending.back() != '(')
+            return;
+
+        PopPending();
+
+        auto* currentValue = &NextParameterValue();
+        auto valueHasStarted = false;
+        auto parenthesisDepth = 0;
+        while (true)
+        {
+            if (m_pending.empty())
+                throw ParsingException(CreatePos(m_line, static_cast<unsigned>(m_line.m_line.size())), "Invalid use of define");
+
+            const auto c = m_pending.back();
+            const auto origin = m_pending_origins.back();
+            PopPending();
+
+            if (c == ',' && parenthesisDepth <= 0)
             {
-                if (!isalnum(c) && c != '_')
-                {
-                    if (FindDefineForWord(line, wordStart, i, value))
-                    {
-                        std::vector<std::string> parameterValues;
-                        ExtractParametersFromDefineUsage(line, i, i, parameterValues);
-                        const auto defineValue = value->Render(parameterValues);
-
-                        if (!usesDefines)
-                        {
-                            str << std::string(line.m_line, 0, wordStart) << defineValue;
-                            usesDefines = true;
-                        }
-                        else
-                        {
-                            str << std::string(line.m_line, lastWordEnd, wordStart - lastWordEnd) << defineValue;
-                        }
-                        lastWordEnd = i;
-                    }
-                    inWord = false;
-                }
+                currentValue = &NextParameterValue();
+                valueHasStarted = false;
+                continue;
             }
+
+            if (c == ')' && parenthesisDepth <= 0)
+                return;
+
+            if (c == '(')
+                parenthesisDepth++;
+            else if (c == ')')
+                parenthesisDepth--;
+            else if (!valueHasStarted && isspace(static_cast<unsigned char>(c)))
+                continue;
+
+            valueHasStarted = true;
+            currentValue->m_value.push_back(c);
+            currentValue->m_origins.push_back(origin);
         }
+    }
+
+    void AppendReplacement(const std::string& text, const size_t offset, const size_t count, const CharacterOrigin origin)
+    {
+        m_replacement.append(text, offset, count);
+        m_replacement_origins.insert(m_replacement_origins.end(), count, origin);
+    }
+
+    void PushReplacement(const Define& define, const CharacterOrigin& usageOrigin)
+    {
+        m_hide_sets.emplace_back(HideSet{&define, usageOrigin.m_hide_set});
+        const CharacterOrigin valueOrigin{m_hide_sets.size() - 1u, usageOrigin.m_depth + 1u};
 
-        if (inWord)
+        m_replacement.clear();
+        m_replacement_origins.clear();
+
+        if (m_parameter_count == 0u || define.m_parameter_positions.empty())
+        {
+            AppendReplacement(define.m_value, 0u, define.m_value.size(), valueOrigin);
+        }
+        else
         {
-            if (FindDefineForWord(line, wordStart, line.m_line.size(), value))
+            auto lastPos = 0u;
+            for (const auto& parameterPosition : define.m_parameter_positions)
             {
-                const std::vector<std::string> parameterValues;
-                const auto defineValue = value->Render(parameterValues);
+                if (lastPos < parameterPosition.m_parameter_position)
+                    AppendReplacement(define.m_value, lastPos, parameterPosition.m_parameter_position - lastPos, valueOrigin);
 
-                if (!usesDefines)
-                {
-                    str << std::string(line.m_line, 0, wordStart) << defineValue;
-                    usesDefines = true;
-                }
-                else
+                if (parameterPosition.m_parameter_index < m_parameter_count)
                 {
-                    str << std::string(line.m_line, lastWordEnd, wordStart - lastWordEnd) << defineValue;
+                    const auto& parameterValue = m_parameter_values[parameterPosition.m_parameter_index];
+                    m_replacement.append(parameterValue.m_value);
+                    for (const auto& parameterOrigin : parameterValue.m_origins)
+                        m_replacement_origins.push_back(CharacterOrigin{parameterOrigin.m_hide_set, valueOrigin.m_depth});
                 }
-                lastWordEnd = line.m_line.size();
+
+                lastPos = parameterPosition.m_parameter_position;
             }
+
+            if (lastPos < define.m_value.size())
+                AppendReplacement(define.m_value, lastPos, define.m_value.size() - lastPos, valueOrigin);
         }
 
-        if (usesDefines)
+        m_pending.append(m_replacement.rbegin(), m_replacement.rend());
+        m_pending_origins.insert(m_pending_origins.end(), m_replacement_origins.rbegin(), m_replacement_origins.rend());
+    }
+
+public:
+    DefineExpander(const std::unordered_map<std::string, Define>& defines, ParserLine& line)
+        : m_defines(defines),
+          m_line(line),
+          m_hide_sets{HideSet{nullptr, EMPTY_HIDE_SET}},
+          m_pending(line.m_line.rbegin(), line.m_line.rend()),
+          m_pending_origins(line.m_line.size(), CharacterOrigin{EMPTY_HIDE_SET, 0u}),
+          m_parameter_count(0u)
+    {
+        m_result.reserve(line.m_line.size());
+    }
+
+    void Expand()
+    {
+        auto expandedAnyDefine = false;
+
+        while (!m_pending.empty())
         {
-            if (lastWordEnd < line.m_line.size())
-                str << std::string(line.m_line, lastWordEnd, line.m_line.size() - lastWordEnd);
-            line.m_line = str.str();
+            if (!IsWordStartCharacter(m_pending.back()))
+            {
+                m_result.push_back(m_pending.back());
+                PopPending();
+                continue;
+            }
+
+            const auto wordOrigin = m_pending_origins.back();
+            m_word.clear();
+            while (!m_pending.empty() && IsWordCharacter(m_pending.back()))
+            {
+                m_word.push_back(m_pending.back());
+                PopPending();
+            }
+
+            const auto foundDefine = m_defines.find(m_word);
+            if (foundDefine == m_defines.end() || IsHidden(wordOrigin.m_hide_set, &foundDefine->second))
+            {
+                m_result.append(m_word);
+                continue;
+            }
+
+            if (wordOrigin.m_depth > MAX_DEFINE_ITERATIONS)
+                throw ParsingException(CreatePos(m_line, 1), "Potential define loop? Exceeded max define iterations of " + std::to_string(MAX_DEFINE_ITERATIONS) + " iterations.");
+
+            ExtractParameters();
+            PushReplacement(foundDefine->second, wordOrigin);
+            expandedAnyDefine = true;
         }
 
-        defineIterations++;
+        if (expandedAnyDefine)
+            m_line.m_line = std::move(m_result);
     }
-    while (usesDefines);
+};
+
+void DefinesStreamProxy::ExpandDefines(ParserLine& line) const
+{
+    if (m_defines.empty())
+        return;
+
+    DefineExpander expander(m_defines, line);
+    expander.Expand();
 }
 
 void DefinesStreamProxy::AddDefine(Define define)
 {
-    m_defines[define.m_name] = std::move(define);
+    for (auto& activeRecording : m_active_recordings)
+        activeRecording.m_recording.m_define_changes.emplace_back(false, define);
+
+    const auto defineHash = HashDefine(define);
+    const auto existingDefine = m_defines.find(define.m_name);
+    if (existingDefine != m_defines.end())
+    {
+        m_defines_hash ^= HashDefine(existingDefine->second);
+        existingDefine->second = std::move(define);
+    }
+    else
+        m_defines.emplace(define.m_name, std::move(define));
+
+    m_defines_hash ^= defineHash;
 }
 
 void DefinesStreamProxy::Undefine(const std::string& name)
 {
     const auto entry = m_defines.find(name);
 
-    if (entry != m_defines.end())
-        m_defines.erase(entry);
+    if (entry == m_defines.end())
+        return;
+
+    for (auto& activeRecording : m_active_recordings)
+        activeRecording.m_recording.m_define_changes.emplace_back(true, Define(name, std::string()));
+
+    m_defines_hash ^= HashDefine(entry->second);
+    m_defines.erase(entry);
+}
+
+size_t DefinesStreamProxy::GetDefinesHash() const
+{
+    return m_defines_hash;
+}
+
+bool DefinesStreamProxy::CanStartRecording() const
+{
+    return !m_in_define && (m_modes.empty() || m_modes.top() == BlockMode::IN_BLOCK);
+}
+
+void DefinesStreamProxy::StartRecording()
+{
+    // Lines that are already waiting to be replayed come before anything that is recorded now
+    m_active_recordings.emplace_back(m_modes.size(), m_replayed_lines.size());
+}
+
+bool DefinesStreamProxy::StopRecording(Recording& recording)
+{
+    if (m_active_recordings.empty())
+        return false;
+
+    auto& activeRecording = m_active_recordings.back();
+
+    // Replayed lines that were not returned yet still belong to the recording when they were replayed while recording
+    for (auto replayedLineIndex = activeRecording.m_replayed_lines_to_skip; replayedLineIndex < m_replayed_lines.size(); replayedLineIndex++)
+        activeRecording.m_recording.m_lines.emplace_back(m_replayed_lines[replayedLineIndex]);
+
+    const auto canBeReplayed = activeRecording.m_can_be_replayed && !m_in_define && m_modes.size() == activeRecording.m_block_depth;
+    recording = std::move(activeRecording.m_recording);
+    m_active_recordings.pop_back();
+
+    return canBeReplayed;
+}
+
+void DefinesStreamProxy::Replay(const Recording& recording)
+{
+    for (const auto& defineChange : recording.m_define_changes)
+    {
+        if (defineChange.m_is_undefine)
+            Undefine(defineChange.m_define.m_name);
+        else
+            AddDefine(defineChange.m_define);
+    }
+
+    m_replayed_lines.insert(m_replayed_lines.end(), recording.m_lines.begin(), recording.m_lines.end());
+}
+
+ParserLine DefinesStreamProxy::NextReplayedLine()
+{
+    auto line = std::move(m_replayed_lines.front());
+    m_replayed_lines.pop_front();
+
+    for (auto& activeRecording : m_active_recordings)
+    {
+        if (activeRecording.m_replayed_lines_to_skip > 0)
+            activeRecording.m_replayed_lines_to_skip--;
+        else
+            activeRecording.m_recording.m_lines.emplace_back(line);
+    }
+
+    return line;
+}
+
+ParserLine DefinesStreamProxy::RecordLine(ParserLine line)
+{
+    for (auto& activeRecording : m_active_recordings)
+        activeRecording.m_recording.m_lines.emplace_back(line);
+
+    return line;
 }
 
 ParserLine DefinesStreamProxy::NextLine()
 {
-    auto line = m_stream->NextLine();
+    if (!m_replayed_lines.empty())
+        return NextReplayedLine();
+
+    ParserLine line;
+    if (m_has_pending_line)
+    {
+        line = std::move(m_pending_line);
+        m_has_pending_line = false;
+    }
+    else
+        line = m_stream->NextLine();
 
     while (true)
     {
+        // Reading the line can replay an included file which comes before the line
+        if (!m_replayed_lines.empty())
+        {
+            m_pending_line = std::move(line);
+            m_has_pending_line = true;
+            return NextReplayedLine();
+        }
+
         if (m_in_define)
         {
             ContinueDefine(line);
             if (!m_skip_directive_lines)
             {
                 line.m_line = std::string();
-                return line;
+                return RecordLine(std::move(line));
             }
 
             line = m_stream->NextLine();
@@ -723,7 +956,7 @@ ParserLine DefinesStreamProxy::NextLine()
             if (!m_skip_directive_lines)
             {
                 line.m_line = std::string();
-                return line;
+                return RecordLine(std::move(line));
             }
 
             line = m_stream->NextLine();
@@ -731,7 +964,7 @@ ParserLine DefinesStreamProxy::NextLine()
         else
         {
             ExpandDefines(line);
-            return line;
+            return RecordLine(std::move(line));
         }
     }
 }
@@ -753,5 +986,5 @@ bool DefinesStreamProxy::IsOpen() const
 
 bool DefinesStreamProxy::Eof() const
 {
-    return m_stream->Eof();
+    return m_replayed_lines.empty() && !m_has_pending_line && m_stream->Eof();
 }
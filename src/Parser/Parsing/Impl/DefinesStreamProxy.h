@@ -1,8 +1,10 @@
 #pragma once
 
-#include <map>
+#include <deque>
 #include <stack>
 #include <sstream>
+#include <unordered_map>
+#include <vector>
 
 #include "AbstractDirectiveStreamProxy.h"
 #include "Parsing/IParserLineStream.h"
@@ -20,6 +22,7 @@ class DefinesStreamProxy final : public AbstractDirectiveStreamProxy
     static constexpr const char* ENDIF_DIRECTIVE = "endif";
     static constexpr const char* DEFINED_KEYWORD = "defined";
 
+    // Maximum amount of nested define expansions before assuming a define loop
     static constexpr auto MAX_DEFINE_ITERATIONS = 128u;
 
 public:
@@ -46,7 +49,40 @@ public:
         _NODISCARD std::string Render(const std::vector<std::string>& parameterValues) const;
     };
 
+    class DefineChange
+    {
+    public:
+        bool m_is_undefine;
+        Define m_define;
+
+        DefineChange(bool isUndefine, Define define);
+    };
+
+    /**
+     * \brief The lines a proxy returned and the changes it made to its defines while reading a part of its input, usually an included file.
+     * Replaying it on a proxy with the same defines has the same result as reading that part of the input again.
+     */
+    class Recording
+    {
+    public:
+        std::vector<ParserLine> m_lines;
+        std::vector<DefineChange> m_define_changes;
+    };
+
 private:
+    class DefineExpander;
+
+    class ActiveRecording
+    {
+    public:
+        Recording m_recording;
+        size_t m_block_depth;
+        size_t m_replayed_lines_to_skip;
+        bool m_can_be_replayed;
+
+        ActiveRecording(size_t blockDepth, size_t replayedLinesToSkip);
+    };
+
     enum class BlockMode
     {
         NOT_IN_BLOCK,
@@ -56,7 +92,7 @@ private:
 
     IParserLineStream* const m_stream;
     const bool m_skip_directive_lines;
-    std::map<std::string, Define> m_defines;
+    std::unordered_map<std::string, Define> m_defines;
     std::stack<BlockMode> m_modes;
     unsigned m_ignore_depth;
 
@@ -65,6 +101,17 @@ private:
     std::ostringstream m_current_define_value;
     std::vector<std::string> m_current_define_parameters;
 
+    size_t m_defines_hash;
+    std::vector<ActiveRecording> m_active_recordings;
+    std::deque<ParserLine> m_replayed_lines;
+    bool m_has_pending_line;
+    ParserLine m_pending_line;
+
+    static size_t HashDefine(const Define& define);
+    void OnBlockChanged();
+    ParserLine NextReplayedLine();
+    ParserLine RecordLine(ParserLine line);
+
     static int GetLineEndEscapePos(const ParserLine& line);
     static std::vector<std::string> MatchDefineParameters(const ParserLine& line, unsigned& parameterPosition);
     void ContinueDefine(const ParserLine& line);
@@ -77,9 +124,6 @@ private:
     _NODISCARD bool MatchEndifDirective(const ParserLine& line, unsigned directiveStartPosition, unsigned directiveEndPosition);
     _NODISCARD bool MatchDirectives(const ParserLine& line);
 
-    static void ExtractParametersFromDefineUsage(const ParserLine& line, unsigned parameterStart, unsigned& parameterEnd, std::vector<std::string>& parameterValues);
-    bool FindDefineForWord(const ParserLine& line, unsigned wordStart, unsigned wordEnd, const Define*& value) const;
-
     static bool MatchDefinedExpression(const ParserLine& line, unsigned& pos, std::string& definitionName);
     void ExpandDefinedExpressions(ParserLine& line) const;
 
@@ -91,6 +135,33 @@ public:
 
     void ExpandDefines(ParserLine& line) const;
 
+    /**
+     * \brief A hash of all defines of the proxy. It is the same whenever the proxy has the same defines, no matter in which order they were added.
+     */
+    _NODISCARD size_t GetDefinesHash() const;
+
+    /**
+     * \brief Whether the following input can be recorded. This is not the case when the proxy is inside a multiline define or a block that is skipped.
+     */
+    _NODISCARD bool CanStartRecording() const;
+
+    /**
+     * \brief Starts recording the returned lines and define changes. Recordings can be nested.
+     */
+    void StartRecording();
+
+    /**
+     * \brief Stops the recording that was started last.
+     * \param recording The recording to move the recorded lines and define changes into.
+     * \return \c true if the recording can be replayed, \c false if the recorded input changed blocks it did not open or ended inside a define.
+     */
+    bool StopRecording(Recording& recording);
+
+    /**
+     * \brief Applies the define changes of a recording and returns its lines before continuing with the input.
+     */
+    void Replay(const Recording& recording);
+
     _NODISCARD std::unique_ptr<ISimpleExpression> ParseExpression(std::shared_ptr<std::string> fileName, int lineNumber, std::string expressionString) const;
 
     ParserLine NextLine() override;
@@ -0,0 +1,119 @@
+#include "IncludeCachingStreamProxy.h"
+
+IncludeCachingStreamProxy::RecordedInclude::RecordedInclude(std::string filename, const size_t definesHash, std::shared_ptr<std::string> includingFile)
+    : m_filename(std::move(filename)),
+      m_defines_hash(definesHash),
+      m_including_file(std::move(includingFile)),
+      m_can_be_cached(true)
+{
+}
+
+IncludeCachingStreamProxy::IncludeCachingStreamProxy(IParserLineStream* stream, PreprocessedIncludeCache* cache)
+    : m_stream(stream),
+      m_cache(cache),
+      m_defines(nullptr)
+{
+}
+
+void IncludeCachingStreamProxy::SetDefinesProxy(DefinesStreamProxy* defines)
+{
+    m_defines = defines;
+}
+
+bool IncludeCachingStreamProxy::IsPragmaDirective(const ParserLine& line)
+{
+    unsigned directiveStartPos, directiveEndPos;
+
+    if (!FindDirective(line, directiveStartPos, directiveEndPos))
+        return false;
+
+    directiveStartPos++;
+    return directiveEndPos - directiveStartPos == std::char_traits<char>::length(PRAGMA_DIRECTIVE)
+        && MatchString(line, directiveStartPos, PRAGMA_DIRECTIVE, std::char_traits<char>::length(PRAGMA_DIRECTIVE));
+}
+
+void IncludeCachingStreamProxy::EndRecordedIncludes(const ParserLine& line)
+{
+    // An included file ended when a line of the file that included it is read, which also ends all files it included itself
+    auto endedIncludeCount = m_recorded_includes.size();
+    if (!line.IsEof())
+    {
+        endedIncludeCount = 0u;
+        for (auto i = m_recorded_includes.size(); i > 0; i--)
+        {
+            if (m_recorded_includes[i - 1].m_including_file == line.m_filename)
+            {
+                endedIncludeCount = m_recorded_includes.size() - (i - 1);
+                break;
+            }
+        }
+    }
+
+    for (; endedIncludeCount > 0; endedIncludeCount--)
+    {
+        const auto& recordedInclude = m_recorded_includes.back();
+
+        DefinesStreamProxy::Recording recording;
+        if (m_defines->StopRecording(recording) && recordedInclude.m_can_be_cached)
+            m_cache->Add(recordedInclude.m_filename, recordedInclude.m_defines_hash, std::move(recording));
+
+        m_recorded_includes.pop_back();
+    }
+}
+
+ParserLine IncludeCachingStreamProxy::NextLine()
+{
+    auto line = m_stream->NextLine();
+
+    if (!m_recorded_includes.empty())
+    {
+        EndRecordedIncludes(line);
+
+        // Pragmas like "once" depend on more than the defines, so files using them are not cached
+        if (IsPragmaDirective(line))
+        {
+            for (auto& recordedInclude : m_recorded_includes)
+                recordedInclude.m_can_be_cached = false;
+        }
+    }
+
+    m_current_file = line.m_filename;
+    return line;
+}
+
+bool IncludeCachingStreamProxy::IncludeFile(const std::string& filename)
+{
+    if (!m_defines || !m_defines->CanStartRecording())
+        return m_stream->IncludeFile(filename);
+
+    const auto definesHash = m_defines->GetDefinesHash();
+    const auto* cachedRecording = m_cache->Find(filename, definesHash);
+    if (cachedRecording)
+    {
+        m_defines->Replay(*cachedRecording);
+        return true;
+    }
+
+    if (!m_stream->IncludeFile(filename))
+        return false;
+
+    m_recorded_includes.emplace_back(filename, definesHash, m_current_file);
+    m_defines->StartRecording();
+
+    return true;
+}
+
+void IncludeCachingStreamProxy::PopCurrentFile()
+{
+    m_stream->PopCurrentFile();
+}
+
+bool IncludeCachingStreamProxy::IsOpen() const
+{
+    return m_stream->IsOpen();
+}
+
+bool IncludeCachingStreamProxy::Eof() const
+{
+    return m_stream->Eof();
+}
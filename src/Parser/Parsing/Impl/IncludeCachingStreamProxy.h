@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "AbstractDirectiveStreamProxy.h"
+#include "DefinesStreamProxy.h"
+#include "PreprocessedIncludeCache.h"
+#include "Parsing/IParserLineStream.h"
+
+/**
+ * \brief Replays files that were already included with the same defines instead of reading and preprocessing them again.
+ * It has to be placed below the proxy handling includes, the defines proxy above it records the included files that are not cached yet.
+ */
+class IncludeCachingStreamProxy final : public AbstractDirectiveStreamProxy
+{
+    static constexpr const char* PRAGMA_DIRECTIVE = "pragma";
+
+    class RecordedInclude
+    {
+    public:
+        std::string m_filename;
+        size_t m_defines_hash;
+        std::shared_ptr<std::string> m_including_file;
+        bool m_can_be_cached;
+
+        RecordedInclude(std::string filename, size_t definesHash, std::shared_ptr<std::string> includingFile);
+    };
+
+    IParserLineStream* const m_stream;
+    PreprocessedIncludeCache* const m_cache;
+    DefinesStreamProxy* m_defines;
+    std::vector<RecordedInclude> m_recorded_includes;
+    std::shared_ptr<std::string> m_current_file;
+
+    _NODISCARD static bool IsPragmaDirective(const ParserLine& line);
+    void EndRecordedIncludes(const ParserLine& line);
+
+public:
+    IncludeCachingStreamProxy(IParserLineStream* stream, PreprocessedIncludeCache* cache);
+
+    void SetDefinesProxy(DefinesStreamProxy* defines);
+
+    ParserLine NextLine() override;
+    bool IncludeFile(const std::string& filename) override;
+    void PopCurrentFile() override;
+    _NODISCARD bool IsOpen() const override;
+    _NODISCARD bool Eof() const override;
+};
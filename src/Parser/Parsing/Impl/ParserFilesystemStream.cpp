@@ -1,6 +1,5 @@
 #include "ParserFilesystemStream.h"
 
-#include <sstream>
 #include <filesystem>
 
 namespace fs = std::filesystem;
@@ -8,6 +7,7 @@ namespace fs = std::filesystem;
 ParserFilesystemStream::FileInfo::FileInfo(std::string filePath)
     : m_file_path(std::make_shared<std::string>(std::move(filePath))),
       m_stream(*m_file_path),
+      m_reader(m_stream),
       m_line_number(1)
 {
 }
@@ -15,7 +15,7 @@ ParserFilesystemStream::FileInfo::FileInfo(std::string filePath)
 ParserFilesystemStream::ParserFilesystemStream(const std::string& path)
 {
     const auto absolutePath = absolute(fs::path(path));
-    m_files.emplace(FileInfo(absolutePath.string()));
+    m_files.emplace(absolutePath.string());
 }
 
 bool ParserFilesystemStream::IsOpen() const
@@ -26,43 +26,19 @@ bool ParserFilesystemStream::IsOpen() const
 
 ParserLine ParserFilesystemStream::NextLine()
 {
-    std::ostringstream str;
-    auto hasLength = false;
-
-    if (m_files.empty())
-        return ParserLine();
-
-    while(!m_files.empty())
+    while (!m_files.empty())
     {
         auto& fileInfo = m_files.top();
 
-        auto c = fileInfo.m_stream.get();
-        while (c != EOF)
+        std::string_view line;
+        if (fileInfo.m_reader.NextLine(line))
         {
-            switch (c)
-            {
-            case '\r':
-                c = fileInfo.m_stream.get();
-                if (c == '\n')
-                    return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number++, str.str());
-                str << '\r';
-                hasLength = true;
-                continue;
-
-            case '\n':
-                return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number++, str.str());
-
-            default:
-                str << static_cast<char>(c);
-                hasLength = true;
-                break;
-            }
-
-            c = fileInfo.m_stream.get();
+            if (fileInfo.m_reader.Eof())
+                return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number, std::string(line));
+
+            return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number++, std::string(line));
         }
 
-        if(hasLength)
-            return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number, str.str());
         m_files.pop();
     }
 
@@ -78,12 +54,14 @@ bool ParserFilesystemStream::IncludeFile(const std::string& filename)
     newFilePath.remove_filename().concat(filename);
     newFilePath = absolute(newFilePath);
 
-    FileInfo fileInfo(newFilePath.string());
+    m_files.emplace(newFilePath.string());
 
-    if (!fileInfo.m_stream.is_open())
+    if (!m_files.top().m_stream.is_open())
+    {
+        m_files.pop();
         return false;
+    }
 
-    m_files.emplace(std::move(fileInfo));
     return true;
 }
 
@@ -96,5 +74,5 @@ void ParserFilesystemStream::PopCurrentFile()
 bool ParserFilesystemStream::Eof() const
 {
     return m_files.empty()
-        || m_files.top().m_stream.eof();
+        || m_files.top().m_reader.Eof();
 }
@@ -3,6 +3,7 @@
 #include <stack>
 #include <fstream>
 
+#include "BufferedLineReader.h"
 #include "Parsing/IParserLineStream.h"
 
 class ParserFilesystemStream final : public IParserLineStream
@@ -12,9 +13,15 @@ class ParserFilesystemStream final : public IParserLineStream
     public:
         std::shared_ptr<std::string> m_file_path;
         std::ifstream m_stream;
+        BufferedLineReader m_reader;
         int m_line_number;
 
         explicit FileInfo(std::string filePath);
+        ~FileInfo() = default;
+        FileInfo(const FileInfo& other) = delete;
+        FileInfo(FileInfo&& other) noexcept = delete;
+        FileInfo& operator=(const FileInfo& other) = delete;
+        FileInfo& operator=(FileInfo&& other) noexcept = delete;
     };
     std::stack<FileInfo> m_files;
 
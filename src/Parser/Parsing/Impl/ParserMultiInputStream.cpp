@@ -1,10 +1,9 @@
 #include "ParserMultiInputStream.h"
 
-#include <sstream>
-
 ParserMultiInputStream::FileInfo::FileInfo(std::unique_ptr<std::istream> stream, std::string filePath)
     : m_owned_stream(std::move(stream)),
       m_stream(*m_owned_stream),
+      m_reader(m_stream),
       m_file_path(std::make_shared<std::string>(std::move(filePath))),
       m_line_number(1)
 {
@@ -12,6 +11,7 @@ ParserMultiInputStream::FileInfo::FileInfo(std::unique_ptr<std::istream> stream,
 
 ParserMultiInputStream::FileInfo::FileInfo(std::istream& stream, std::string filePath)
     : m_stream(stream),
+      m_reader(m_stream),
       m_file_path(std::make_shared<std::string>(std::move(filePath))),
       m_line_number(1)
 {
@@ -31,43 +31,19 @@ ParserMultiInputStream::ParserMultiInputStream(std::istream& stream, std::string
 
 ParserLine ParserMultiInputStream::NextLine()
 {
-    std::ostringstream str;
-    auto hasLength = false;
-
-    if (m_files.empty())
-        return ParserLine();
-
     while (!m_files.empty())
     {
         auto& fileInfo = m_files.top();
 
-        auto c = fileInfo.m_stream.get();
-        while (c != EOF)
+        std::string_view line;
+        if (fileInfo.m_reader.NextLine(line))
         {
-            switch (c)
-            {
-            case '\r':
-                c = fileInfo.m_stream.get();
-                if (c == '\n')
-                    return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number++, str.str());
-                str << '\r';
-                hasLength = true;
-                continue;
-
-            case '\n':
-                return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number++, str.str());
-
-            default:
-                str << static_cast<char>(c);
-                hasLength = true;
-                break;
-            }
+            if (fileInfo.m_reader.Eof())
+                return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number, std::string(line));
 
-            c = fileInfo.m_stream.get();
+            return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number++, std::string(line));
         }
 
-        if (hasLength)
-            return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number, str.str());
         m_files.pop();
     }
 
@@ -5,6 +5,7 @@
 #include <memory>
 #include <functional>
 
+#include "BufferedLineReader.h"
 #include "Parsing/IParserLineStream.h"
 
 class ParserMultiInputStream final : public IParserLineStream
@@ -18,11 +19,17 @@ private:
     public:
         std::unique_ptr<std::istream> m_owned_stream;
         std::istream& m_stream;
+        BufferedLineReader m_reader;
         std::shared_ptr<std::string> m_file_path;
         int m_line_number;
 
         FileInfo(std::unique_ptr<std::istream> stream, std::string filePath);
         FileInfo(std::istream& stream, std::string filePath);
+        ~FileInfo() = default;
+        FileInfo(const FileInfo& other) = delete;
+        FileInfo(FileInfo&& other) noexcept = delete;
+        FileInfo& operator=(const FileInfo& other) = delete;
+        FileInfo& operator=(FileInfo&& other) noexcept = delete;
     };
 
     const include_callback_t m_include_callback;
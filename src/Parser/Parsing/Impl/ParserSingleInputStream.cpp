@@ -1,9 +1,7 @@
 #include "ParserSingleInputStream.h"
 
-#include <sstream>
-
 ParserSingleInputStream::ParserSingleInputStream(std::istream& stream, std::string fileName)
-    : m_stream(stream),
+    : m_reader(stream),
       m_file_name(std::make_shared<std::string>(std::move(fileName))),
       m_line_number(1)
 {
@@ -11,38 +9,15 @@ ParserSingleInputStream::ParserSingleInputStream(std::istream& stream, std::stri
 
 ParserLine ParserSingleInputStream::NextLine()
 {
-    std::ostringstream str;
-    auto hasLength = false;
-
-    auto c = m_stream.get();
-    while (c != EOF)
-    {
-        switch (c)
-        {
-        case '\r':
-            c = m_stream.get();
-            if (c == '\n')
-                return ParserLine(m_file_name, m_line_number++, str.str());
-            str << '\r';
-            hasLength = true;
-            continue;
-
-        case '\n':
-            return ParserLine(m_file_name, m_line_number++, str.str());
-
-        default:
-            str << static_cast<char>(c);
-            hasLength = true;
-            break;
-        }
-
-        c = m_stream.get();
-    }
+    std::string_view line;
+    if (!m_reader.NextLine(line))
+        return ParserLine();
 
-    if (hasLength)
-        return ParserLine(m_file_name, m_line_number, str.str());
+    // The last line of the input does not count as finished if it has no line terminator
+    if (m_reader.Eof())
+        return ParserLine(m_file_name, m_line_number, std::string(line));
 
-    return ParserLine();
+    return ParserLine(m_file_name, m_line_number++, std::string(line));
 }
 
 bool ParserSingleInputStream::IncludeFile(const std::string& filename)
@@ -56,10 +31,10 @@ void ParserSingleInputStream::PopCurrentFile()
 
 bool ParserSingleInputStream::IsOpen() const
 {
-    return !m_stream.eof();
+    return !m_reader.Eof();
 }
 
 bool ParserSingleInputStream::Eof() const
 {
-    return m_stream.eof();
+    return m_reader.Eof();
 }
@@ -3,11 +3,12 @@
 #include <istream>
 #include <memory>
 
+#include "BufferedLineReader.h"
 #include "Parsing/IParserLineStream.h"
 
 class ParserSingleInputStream final : public IParserLineStream
 {
-    std::istream& m_stream;
+    BufferedLineReader m_reader;
     std::shared_ptr<std::string> m_file_name;
     int m_line_number;
 
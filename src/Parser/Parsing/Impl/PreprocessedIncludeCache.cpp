@@ -0,0 +1,19 @@
+#include "PreprocessedIncludeCache.h"
+
+const DefinesStreamProxy::Recording* PreprocessedIncludeCache::Find(const std::string& filename, const size_t definesHash) const
+{
+    const auto recordingsForFile = m_recordings_by_filename.find(filename);
+    if (recordingsForFile == m_recordings_by_filename.end())
+        return nullptr;
+
+    const auto recording = recordingsForFile->second.find(definesHash);
+    if (recording == recordingsForFile->second.end())
+        return nullptr;
+
+    return &recording->second;
+}
+
+void PreprocessedIncludeCache::Add(const std::string& filename, const size_t definesHash, DefinesStreamProxy::Recording recording)
+{
+    m_recordings_by_filename[filename].emplace(definesHash, std::move(recording));
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "DefinesStreamProxy.h"
+#include "Utils/ClassUtils.h"
+
+/**
+ * \brief Keeps the preprocessed lines and define changes of included files.
+ * An entry is only used when a file is included again with the same defines, since the result of preprocessing it depends on them.
+ */
+class PreprocessedIncludeCache
+{
+    std::unordered_map<std::string, std::unordered_map<size_t, DefinesStreamProxy::Recording>> m_recordings_by_filename;
+
+public:
+    _NODISCARD const DefinesStreamProxy::Recording* Find(const std::string& filename, size_t definesHash) const;
+    void Add(const std::string& filename, size_t definesHash, DefinesStreamProxy::Recording recording);
+};
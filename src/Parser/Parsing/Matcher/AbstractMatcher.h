@@ -4,6 +4,7 @@
 
 #include "Parsing/IParserValue.h"
 #include "Parsing/ILexer.h"
+#include "Parsing/Matcher/MatcherFirstTokens.h"
 #include "Parsing/Matcher/MatcherResult.h"
 
 template <typename TokenType>
@@ -60,6 +61,18 @@ public:
         m_transform_func = std::move(transform);
     }
 
+    /**
+     * \brief Collects the tokens a match of this matcher can start with. This allows to skip matchers that cannot match the next token anyway.
+     * \param firstTokens The collection to add the tokens to.
+     * \return \c true if every match starts with one of the collected tokens, \c false if the matcher can also match without checking a token.
+     * In that case whatever follows the matcher can start the match as well.
+     */
+    virtual bool CollectFirstTokens(MatcherFirstTokens& firstTokens) const
+    {
+        firstTokens.AddAnyToken();
+        return true;
+    }
+
     MatcherResult<TokenType> Match(ILexer<TokenType>* lexer, const unsigned tokenOffset)
     {
         MatcherResult<TokenType> result = CanMatch(lexer, tokenOffset);
@@ -33,6 +33,18 @@ protected:
     }
 
 public:
+    bool CollectFirstTokens(MatcherFirstTokens& firstTokens) const override
+    {
+        // Matchers that can match without consuming a token let the following matchers decide the first token as well
+        for (const std::unique_ptr<AbstractMatcher<TokenType>>& matcher : m_matchers)
+        {
+            if (matcher->CollectFirstTokens(firstTokens))
+                return true;
+        }
+
+        return false;
+    }
+
     MatcherAnd(std::initializer_list<Movable<std::unique_ptr<AbstractMatcher<TokenType>>>> matchers)
         : m_matchers(std::make_move_iterator(matchers.begin()), std::make_move_iterator(matchers.end()))
     {
@@ -18,6 +18,12 @@ protected:
     }
 
 public:
+    bool CollectFirstTokens(MatcherFirstTokens& firstTokens) const override
+    {
+        // Never matches so there is no token it can start with
+        return true;
+    }
+
     MatcherFalse()
     = default;
 };
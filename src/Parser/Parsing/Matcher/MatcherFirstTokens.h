@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * \brief Describes which tokens a matcher can start with.
+ * Tokens are described by a type and a value key. What these mean is up to the token implementation, matchers of a token type and the parser
+ * that dispatches on them just need to agree on it.
+ */
+class MatcherFirstTokens
+{
+public:
+    static constexpr unsigned MAX_LABEL_DEPTH = 16;
+
+    class Entry
+    {
+    public:
+        int m_type;
+        bool m_any_value;
+        size_t m_value;
+    };
+
+    std::vector<Entry> m_entries;
+    bool m_any_token;
+
+    // Labels can refer to each other, so resolving them is limited to avoid recursing endlessly
+    unsigned m_label_depth;
+
+    MatcherFirstTokens()
+        : m_any_token(false),
+          m_label_depth(0u)
+    {
+    }
+
+    void AddAnyToken()
+    {
+        m_any_token = true;
+    }
+
+    void AddType(const int type)
+    {
+        m_entries.push_back(Entry{type, true, 0u});
+    }
+
+    void AddValue(const int type, const size_t value)
+    {
+        m_entries.push_back(Entry{type, false, value});
+    }
+};
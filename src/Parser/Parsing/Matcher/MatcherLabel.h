@@ -45,6 +45,23 @@ protected:
     }
 
 public:
+    bool CollectFirstTokens(MatcherFirstTokens& firstTokens) const override
+    {
+        const AbstractMatcher<TokenType>* matcher = m_supplier->GetMatcherForLabel(m_label);
+
+        if (!matcher || firstTokens.m_label_depth >= MatcherFirstTokens::MAX_LABEL_DEPTH)
+        {
+            firstTokens.AddAnyToken();
+            return true;
+        }
+
+        firstTokens.m_label_depth++;
+        const auto result = matcher->CollectFirstTokens(firstTokens);
+        firstTokens.m_label_depth--;
+
+        return result;
+    }
+
     MatcherLabel(const IMatcherForLabelSupplier<TokenType>* supplier, const int label)
         : m_supplier(supplier),
           m_label(label)
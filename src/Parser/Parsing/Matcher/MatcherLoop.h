@@ -37,6 +37,11 @@ protected:
     }
 
 public:
+    bool CollectFirstTokens(MatcherFirstTokens& firstTokens) const override
+    {
+        return m_matcher->CollectFirstTokens(firstTokens);
+    }
+
     explicit MatcherLoop(std::unique_ptr<AbstractMatcher<TokenType>> matcher)
         : m_matcher(std::move(matcher))
     {
@@ -25,6 +25,12 @@ protected:
     }
 
 public:
+    bool CollectFirstTokens(MatcherFirstTokens& firstTokens) const override
+    {
+        m_matcher->CollectFirstTokens(firstTokens);
+        return false;
+    }
+
     explicit MatcherOptional(std::unique_ptr<AbstractMatcher<TokenType>> matcher)
         : m_matcher(std::move(matcher))
     {
@@ -31,6 +31,18 @@ protected:
     }
 
 public:
+    bool CollectFirstTokens(MatcherFirstTokens& firstTokens) const override
+    {
+        auto alwaysConsumes = true;
+        for (const std::unique_ptr<AbstractMatcher<TokenType>>& matcher : m_matchers)
+        {
+            if (!matcher->CollectFirstTokens(firstTokens))
+                alwaysConsumes = false;
+        }
+
+        return alwaysConsumes;
+    }
+
     MatcherOr(std::initializer_list<Movable<std::unique_ptr<AbstractMatcher<TokenType>>>> matchers)
         : m_matchers(std::make_move_iterator(matchers.begin()), std::make_move_iterator(matchers.end()))
     {
@@ -18,6 +18,11 @@ protected:
     }
 
 public:
+    bool CollectFirstTokens(MatcherFirstTokens& firstTokens) const override
+    {
+        return false;
+    }
+
     MatcherTrue()
     = default;
 };
@@ -74,6 +74,19 @@ public:
         return nullptr;
     }
 
+    /**
+     * \brief Collects the tokens a match of this sequence can start with.
+     */
+    void CollectFirstTokens(MatcherFirstTokens& firstTokens) const
+    {
+        // A sequence without matchers never matches
+        if (!m_entry)
+            return;
+
+        if (!m_entry->CollectFirstTokens(firstTokens))
+            firstTokens.AddAnyToken();
+    }
+
     _NODISCARD bool MatchSequence(ILexer<TokenType>* lexer, ParserState* state, unsigned& consumedTokenCount) const
     {
         if (!m_entry)
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "AbstractSequence.h"
+#include "Parsing/Matcher/MatcherFirstTokens.h"
+
+/**
+ * \brief Groups the sequences of a parser state by the tokens they can start with.
+ * Candidates for a token keep the order of the sequences they were created from so trying them gives the same result as trying all sequences.
+ */
+template<typename TokenType, typename ParserState>
+class SequenceDispatchIndex
+{
+public:
+    typedef AbstractSequence<TokenType, ParserState> sequence_t;
+
+private:
+    class TypeCandidates
+    {
+    public:
+        std::vector<sequence_t*> m_any_value;
+        std::unordered_map<size_t, std::vector<sequence_t*>> m_by_value;
+    };
+
+    std::vector<sequence_t*> m_any_token;
+    std::unordered_map<int, TypeCandidates> m_by_type;
+
+    static bool StartsWith(const MatcherFirstTokens& firstTokens, const int type, const bool anyValue, const size_t value)
+    {
+        if (firstTokens.m_any_token)
+            return true;
+
+        for (const auto& entry : firstTokens.m_entries)
+        {
+            if (entry.m_type == type && (entry.m_any_value || (!anyValue && entry.m_value == value)))
+                return true;
+        }
+
+        return false;
+    }
+
+public:
+    explicit SequenceDispatchIndex(const std::vector<sequence_t*>& sequences)
+    {
+        std::vector<MatcherFirstTokens> firstTokensBySequence(sequences.size());
+        for (auto i = 0u; i < sequences.size(); i++)
+            sequences[i]->CollectFirstTokens(firstTokensBySequence[i]);
+
+        for (const auto& firstTokens : firstTokensBySequence)
+        {
+            for (const auto& entry : firstTokens.m_entries)
+            {
+                auto& typeCandidates = m_by_type[entry.m_type];
+                if (!entry.m_any_value)
+                    typeCandidates.m_by_value[entry.m_value];
+            }
+        }
+
+        for (auto i = 0u; i < sequences.size(); i++)
+        {
+            const auto& firstTokens = firstTokensBySequence[i];
+            if (firstTokens.m_any_token)
+                m_any_token.push_back(sequences[i]);
+
+            for (auto& [type, typeCandidates] : m_by_type)
+            {
+                if (StartsWith(firstTokens, type, true, 0u))
+                    typeCandidates.m_any_value.push_back(sequences[i]);
+
+                for (auto& [value, valueCandidates] : typeCandidates.m_by_value)
+                {
+                    if (StartsWith(firstTokens, type, false, value))
+                        valueCandidates.push_back(sequences[i]);
+                }
+            }
+        }
+    }
+
+    /**
+     * \brief Returns all sequences that can start with a token of the specified type and value key in the order they were specified.
+     */
+    _NODISCARD const std::vector<sequence_t*>& GetCandidates(const int type, const size_t value) const
+    {
+        const auto foundType = m_by_type.find(type);
+        if (foundType == m_by_type.end())
+            return m_any_token;
+
+        const auto& typeCandidates = foundType->second;
+        const auto foundValue = typeCandidates.m_by_value.find(value);
+        if (foundValue == typeCandidates.m_by_value.end())
+            return typeCandidates.m_any_value;
+
+        return foundValue->second;
+    }
+};
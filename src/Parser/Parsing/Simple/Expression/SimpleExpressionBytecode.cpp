@@ -0,0 +1,191 @@
+#include "SimpleExpressionBytecode.h"
+
+#include <cassert>
+
+#include "SimpleExpressionConditionalOperator.h"
+#include "SimpleExpressionScopeValue.h"
+
+SimpleExpressionBytecode::SimpleExpressionBytecode(const ISimpleExpression* expression)
+    : m_expression(expression),
+      m_stack_size(0u),
+      m_max_stack_size(0u)
+{
+    assert(expression);
+    Compile(expression);
+    assert(m_stack_size == 1u);
+}
+
+unsigned SimpleExpressionBytecode::AddInstruction(const OpCode opCode, const unsigned operand)
+{
+    const auto index = static_cast<unsigned>(m_instructions.size());
+    m_instructions.emplace_back(Instruction{opCode, operand});
+    return index;
+}
+
+void SimpleExpressionBytecode::ChangeStackSize(const int change)
+{
+    m_stack_size = static_cast<unsigned>(static_cast<int>(m_stack_size) + change);
+    if (m_stack_size > m_max_stack_size)
+        m_max_stack_size = m_stack_size;
+}
+
+bool SimpleExpressionBytecode::Compile(const ISimpleExpression* expression)
+{
+    const auto firstInstruction = static_cast<unsigned>(m_instructions.size());
+    bool isStatic;
+
+    if (const auto* value = dynamic_cast<const SimpleExpressionValue*>(expression))
+    {
+        AddInstruction(OpCode::PUSH_VALUE, static_cast<unsigned>(m_values.size()));
+        m_values.emplace_back(*value);
+        ChangeStackSize(1);
+        isStatic = true;
+    }
+    else if (const auto* scopeValue = dynamic_cast<const SimpleExpressionScopeValue*>(expression))
+    {
+        AddInstruction(OpCode::PUSH_SCOPE_VALUE, static_cast<unsigned>(m_scope_value_names.size()));
+        m_scope_value_names.emplace_back(&scopeValue->m_value_name);
+        ChangeStackSize(1);
+        isStatic = false;
+    }
+    else if (const auto* unaryOperation = dynamic_cast<const SimpleExpressionUnaryOperation*>(expression))
+    {
+        isStatic = Compile(unaryOperation->m_operand.get());
+
+        AddInstruction(OpCode::UNARY_OPERATION, static_cast<unsigned>(m_unary_operations.size()));
+        m_unary_operations.emplace_back(unaryOperation->m_operation_type);
+    }
+    else if (const auto* binaryOperation = dynamic_cast<const SimpleExpressionBinaryOperation*>(expression))
+    {
+        const auto operand1IsStatic = Compile(binaryOperation->m_operand1.get());
+        const auto operand2IsStatic = Compile(binaryOperation->m_operand2.get());
+        isStatic = operand1IsStatic && operand2IsStatic;
+
+        AddInstruction(OpCode::BINARY_OPERATION, static_cast<unsigned>(m_binary_operations.size()));
+        m_binary_operations.emplace_back(binaryOperation->m_operation_type);
+        ChangeStackSize(-1);
+    }
+    else if (const auto* conditionalOperator = dynamic_cast<const SimpleExpressionConditionalOperator*>(expression))
+    {
+        const auto conditionIsStatic = Compile(conditionalOperator->m_condition.get());
+        const auto jumpToFalseValue = AddInstruction(OpCode::JUMP_IF_FALSE, 0u);
+        ChangeStackSize(-1);
+
+        const auto trueValueIsStatic = Compile(conditionalOperator->m_true_value.get());
+        const auto jumpToEnd = AddInstruction(OpCode::JUMP, 0u);
+
+        // Only one of the values ends up on the stack
+        ChangeStackSize(-1);
+        m_instructions[jumpToFalseValue].m_operand = static_cast<unsigned>(m_instructions.size());
+        const auto falseValueIsStatic = Compile(conditionalOperator->m_false_value.get());
+        m_instructions[jumpToEnd].m_operand = static_cast<unsigned>(m_instructions.size());
+
+        isStatic = conditionIsStatic && trueValueIsStatic && falseValueIsStatic;
+    }
+    else
+    {
+        AddInstruction(OpCode::EVALUATE_NODE, static_cast<unsigned>(m_nodes.size()));
+        m_nodes.emplace_back(expression);
+        ChangeStackSize(1);
+        isStatic = expression->IsStatic();
+    }
+
+    m_compiled_expressions.emplace(std::make_pair(expression, CompiledExpression{firstInstruction, static_cast<unsigned>(m_instructions.size()), isStatic}));
+
+    return isStatic;
+}
+
+bool SimpleExpressionBytecode::IsStatic() const
+{
+    return IsStatic(m_expression);
+}
+
+SimpleExpressionValue SimpleExpressionBytecode::EvaluateStatic() const
+{
+    return Evaluate(0u, static_cast<unsigned>(m_instructions.size()), nullptr);
+}
+
+SimpleExpressionValue SimpleExpressionBytecode::EvaluateNonStatic(const ISimpleExpressionScopeValues* scopeValues) const
+{
+    return Evaluate(0u, static_cast<unsigned>(m_instructions.size()), scopeValues);
+}
+
+bool SimpleExpressionBytecode::IsStatic(const ISimpleExpression* expression) const
+{
+    const auto compiledExpression = m_compiled_expressions.find(expression);
+    if (compiledExpression == m_compiled_expressions.end())
+        return expression->IsStatic();
+
+    return compiledExpression->second.m_is_static;
+}
+
+SimpleExpressionValue SimpleExpressionBytecode::EvaluateStatic(const ISimpleExpression* expression) const
+{
+    const auto compiledExpression = m_compiled_expressions.find(expression);
+    if (compiledExpression == m_compiled_expressions.end())
+        return expression->EvaluateStatic();
+
+    return Evaluate(compiledExpression->second.m_first_instruction, compiledExpression->second.m_end_instruction, nullptr);
+}
+
+SimpleExpressionValue SimpleExpressionBytecode::Evaluate(const unsigned firstInstruction, const unsigned endInstruction, const ISimpleExpressionScopeValues* scopeValues) const
+{
+    // Without scope values the expression is evaluated statically
+    std::vector<SimpleExpressionValue> stack;
+    stack.reserve(m_max_stack_size);
+
+    auto instructionIndex = firstInstruction;
+    while (instructionIndex < endInstruction)
+    {
+        const auto& instruction = m_instructions[instructionIndex++];
+
+        switch (instruction.m_op_code)
+        {
+        case OpCode::PUSH_VALUE:
+            stack.emplace_back(m_values[instruction.m_operand]);
+            break;
+
+        case OpCode::PUSH_SCOPE_VALUE:
+            if (scopeValues)
+                stack.emplace_back(scopeValues->ValueByName(*m_scope_value_names[instruction.m_operand]));
+            else
+                stack.emplace_back(0);
+            break;
+
+        case OpCode::EVALUATE_NODE:
+            if (scopeValues)
+                stack.emplace_back(m_nodes[instruction.m_operand]->EvaluateNonStatic(scopeValues));
+            else
+                stack.emplace_back(m_nodes[instruction.m_operand]->EvaluateStatic());
+            break;
+
+        case OpCode::UNARY_OPERATION:
+            stack.back() = m_unary_operations[instruction.m_operand]->m_evaluation_function(stack.back());
+            break;
+
+        case OpCode::BINARY_OPERATION:
+        {
+            const auto operand2 = std::move(stack.back());
+            stack.pop_back();
+            stack.back() = m_binary_operations[instruction.m_operand]->m_evaluation_function(stack.back(), operand2);
+            break;
+        }
+
+        case OpCode::JUMP_IF_FALSE:
+        {
+            const auto conditionIsTruthy = stack.back().IsTruthy();
+            stack.pop_back();
+            if (!conditionIsTruthy)
+                instructionIndex = instruction.m_operand;
+            break;
+        }
+
+        case OpCode::JUMP:
+            instructionIndex = instruction.m_operand;
+            break;
+        }
+    }
+
+    assert(stack.size() == 1u);
+    return std::move(stack.back());
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "ISimpleExpression.h"
+#include "SimpleExpressionBinaryOperation.h"
+#include "SimpleExpressionUnaryOperation.h"
+#include "SimpleExpressionValue.h"
+#include "Utils/ClassUtils.h"
+
+/**
+ * \brief A simple expression compiled to a flat list of instructions for a stack machine.
+ * Besides the whole expression, every operation, value and conditional operator of it can be checked for being static and evaluated by itself.
+ * Expression types that are not part of the simple expressions are kept as nodes that are evaluated as usual.
+ * The bytecode refers to the expression it was compiled from, so it must not outlive it.
+ */
+class SimpleExpressionBytecode
+{
+public:
+    enum class OpCode : uint8_t
+    {
+        PUSH_VALUE,
+        PUSH_SCOPE_VALUE,
+        EVALUATE_NODE,
+        UNARY_OPERATION,
+        BINARY_OPERATION,
+        JUMP_IF_FALSE,
+        JUMP
+    };
+
+    class Instruction
+    {
+    public:
+        OpCode m_op_code;
+        unsigned m_operand;
+    };
+
+    explicit SimpleExpressionBytecode(const ISimpleExpression* expression);
+
+    _NODISCARD bool IsStatic() const;
+    _NODISCARD SimpleExpressionValue EvaluateStatic() const;
+    _NODISCARD SimpleExpressionValue EvaluateNonStatic(const ISimpleExpressionScopeValues* scopeValues) const;
+
+    /**
+     * \brief Checks whether a part of the compiled expression is static. Parts that were not compiled are asked themselves.
+     */
+    _NODISCARD bool IsStatic(const ISimpleExpression* expression) const;
+
+    /**
+     * \brief Evaluates a static part of the compiled expression. Parts that were not compiled evaluate themselves.
+     */
+    _NODISCARD SimpleExpressionValue EvaluateStatic(const ISimpleExpression* expression) const;
+
+private:
+    class CompiledExpression
+    {
+    public:
+        unsigned m_first_instruction;
+        unsigned m_end_instruction;
+        bool m_is_static;
+    };
+
+    bool Compile(const ISimpleExpression* expression);
+    unsigned AddInstruction(OpCode opCode, unsigned operand);
+    void ChangeStackSize(int change);
+    _NODISCARD SimpleExpressionValue Evaluate(unsigned firstInstruction, unsigned endInstruction, const ISimpleExpressionScopeValues* scopeValues) const;
+
+    const ISimpleExpression* m_expression;
+    std::vector<Instruction> m_instructions;
+    std::vector<SimpleExpressionValue> m_values;
+    std::vector<const std::string*> m_scope_value_names;
+    std::vector<const ISimpleExpression*> m_nodes;
+    std::vector<const SimpleExpressionUnaryOperationType*> m_unary_operations;
+    std::vector<const SimpleExpressionBinaryOperationType*> m_binary_operations;
+    std::unordered_map<const ISimpleExpression*, CompiledExpression> m_compiled_expressions;
+
+    unsigned m_stack_size;
+    unsigned m_max_stack_size;
+};
@@ -12,3 +12,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherAnyCharacterBesides::CanMatch(ILex
                ? MatcherResult<SimpleParserValue>::Match(1)
                : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherAnyCharacterBesides::CollectFirstTokens(MatcherFirstTokens& firstTokens) const
+{
+    firstTokens.AddType(static_cast<int>(SimpleParserValueType::CHARACTER));
+    return true;
+}
@@ -14,4 +14,6 @@ protected:
 
 public:
     explicit SimpleMatcherAnyCharacterBesides(std::vector<char> chars);
+
+    bool CollectFirstTokens(MatcherFirstTokens& firstTokens) const override;
 };
@@ -12,3 +12,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherCharacter::CanMatch(ILexer<SimpleP
         ? MatcherResult<SimpleParserValue>::Match(1)
         : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherCharacter::CollectFirstTokens(MatcherFirstTokens& firstTokens) const
+{
+    firstTokens.AddValue(static_cast<int>(SimpleParserValueType::CHARACTER), static_cast<size_t>(static_cast<unsigned char>(m_char)));
+    return true;
+}
@@ -12,4 +12,6 @@ protected:
 
 public:
     explicit SimpleMatcherCharacter(char c);
+
+    bool CollectFirstTokens(MatcherFirstTokens& firstTokens) const override;
 };
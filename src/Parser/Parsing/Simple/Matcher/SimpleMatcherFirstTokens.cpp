@@ -0,0 +1,32 @@
+#include "SimpleMatcherFirstTokens.h"
+
+#include "Parsing/Simple/SimpleSymbolTable.h"
+
+size_t SimpleMatcherFirstTokens::IdentifierKey(const std::string& identifier)
+{
+    return SimpleSymbolTable::CaseFoldedHash(identifier);
+}
+
+void SimpleMatcherFirstTokens::GetTokenKey(const SimpleParserValue& token, int& type, size_t& value)
+{
+    type = static_cast<int>(token.m_type);
+
+    switch (token.m_type)
+    {
+    case SimpleParserValueType::CHARACTER:
+        value = static_cast<size_t>(static_cast<unsigned char>(token.CharacterValue()));
+        break;
+
+    case SimpleParserValueType::MULTI_CHARACTER:
+        value = static_cast<size_t>(token.MultiCharacterValue());
+        break;
+
+    case SimpleParserValueType::IDENTIFIER:
+        value = token.IdentifierFoldedHash();
+        break;
+
+    default:
+        value = 0u;
+        break;
+    }
+}
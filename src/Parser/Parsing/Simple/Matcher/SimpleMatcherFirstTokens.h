@@ -0,0 +1,16 @@
+#pragma once
+
+#include <string>
+
+#include "Parsing/Simple/SimpleParserValue.h"
+
+/**
+ * \brief Describes simple tokens the same way simple matchers describe the tokens they can start with.
+ * Identifiers are keyed case-insensitively so keywords that ignore case can share the key with keywords that do not.
+ */
+class SimpleMatcherFirstTokens
+{
+public:
+    static size_t IdentifierKey(const std::string& identifier);
+    static void GetTokenKey(const SimpleParserValue& token, int& type, size_t& value);
+};
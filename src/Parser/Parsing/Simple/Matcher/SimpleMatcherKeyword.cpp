@@ -1,5 +1,7 @@
 #include "SimpleMatcherKeyword.h"
 
+#include "SimpleMatcherFirstTokens.h"
+
 SimpleMatcherKeyword::SimpleMatcherKeyword(std::string value)
     : m_value(std::move(value))
 {
@@ -14,3 +16,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherKeyword::CanMatch(ILexer<SimplePar
         ? MatcherResult<SimpleParserValue>::Match(1)
         : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherKeyword::CollectFirstTokens(MatcherFirstTokens& firstTokens) const
+{
+    firstTokens.AddValue(static_cast<int>(SimpleParserValueType::IDENTIFIER), SimpleMatcherFirstTokens::IdentifierKey(m_value));
+    return true;
+}
@@ -15,4 +15,6 @@ protected:
 
 public:
     explicit SimpleMatcherKeyword(std::string value);
+
+    bool CollectFirstTokens(MatcherFirstTokens& firstTokens) const override;
 };
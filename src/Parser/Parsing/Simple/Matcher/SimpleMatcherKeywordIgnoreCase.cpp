@@ -2,18 +2,22 @@
 
 #include <algorithm>
 
+#include "Parsing/Simple/SimpleSymbolTable.h"
+
 SimpleMatcherKeywordIgnoreCase::SimpleMatcherKeywordIgnoreCase(std::string value)
     : m_value(std::move(value))
 {
     for (auto& c : m_value)
         c = static_cast<char>(tolower(c));
+
+    m_folded_hash = SimpleSymbolTable::CaseFoldedHash(m_value);
 }
 
 MatcherResult<SimpleParserValue> SimpleMatcherKeywordIgnoreCase::CanMatch(ILexer<SimpleParserValue>* lexer, const unsigned tokenOffset)
 {
     const auto& token = lexer->GetToken(tokenOffset);
 
-    if (token.m_type != SimpleParserValueType::IDENTIFIER)
+    if (token.m_type != SimpleParserValueType::IDENTIFIER || token.IdentifierFoldedHash() != m_folded_hash)
         return MatcherResult<SimpleParserValue>::NoMatch();
 
     const auto& identifierValue = token.IdentifierValue();
@@ -27,3 +31,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherKeywordIgnoreCase::CanMatch(ILexer
 
     return MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherKeywordIgnoreCase::CollectFirstTokens(MatcherFirstTokens& firstTokens) const
+{
+    firstTokens.AddValue(static_cast<int>(SimpleParserValueType::IDENTIFIER), m_folded_hash);
+    return true;
+}
@@ -7,6 +7,7 @@
 
 class SimpleMatcherKeywordIgnoreCase final : public AbstractMatcher<SimpleParserValue>
 {
+    size_t m_folded_hash;
     std::string m_value;
 
 protected:
@@ -14,4 +15,6 @@ protected:
 
 public:
     explicit SimpleMatcherKeywordIgnoreCase(std::string value);
+
+    bool CollectFirstTokens(MatcherFirstTokens& firstTokens) const override;
 };
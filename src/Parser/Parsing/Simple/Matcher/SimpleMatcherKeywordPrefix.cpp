@@ -12,3 +12,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherKeywordPrefix::CanMatch(ILexer<Sim
         ? MatcherResult<SimpleParserValue>::Match(1)
         : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherKeywordPrefix::CollectFirstTokens(MatcherFirstTokens& firstTokens) const
+{
+    firstTokens.AddType(static_cast<int>(SimpleParserValueType::IDENTIFIER));
+    return true;
+}
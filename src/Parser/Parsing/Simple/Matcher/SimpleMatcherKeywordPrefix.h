@@ -14,4 +14,6 @@ protected:
 
 public:
     explicit SimpleMatcherKeywordPrefix(std::string value);
+
+    bool CollectFirstTokens(MatcherFirstTokens& firstTokens) const override;
 };
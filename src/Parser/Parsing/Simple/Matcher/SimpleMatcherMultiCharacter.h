@@ -12,4 +12,6 @@ protected:
 
 public:
     explicit SimpleMatcherMultiCharacter(int multiCharacterSequenceId);
+
+    bool CollectFirstTokens(MatcherFirstTokens& firstTokens) const override;
 };
@@ -11,3 +11,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherValueType::CanMatch(ILexer<SimpleP
         ? MatcherResult<SimpleParserValue>::Match(1)
         : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherValueType::CollectFirstTokens(MatcherFirstTokens& firstTokens) const
+{
+    firstTokens.AddType(static_cast<int>(m_type));
+    return true;
+}
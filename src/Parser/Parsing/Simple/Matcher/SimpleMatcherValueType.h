@@ -12,4 +12,6 @@ protected:
 
 public:
     explicit SimpleMatcherValueType(SimpleParserValueType type);
+
+    bool CollectFirstTokens(MatcherFirstTokens& firstTokens) const override;
 };
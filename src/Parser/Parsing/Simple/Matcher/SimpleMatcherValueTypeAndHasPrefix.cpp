@@ -13,3 +13,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherValueTypeAndHasSignPrefix::CanMatc
                ? MatcherResult<SimpleParserValue>::Match(1)
                : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherValueTypeAndHasSignPrefix::CollectFirstTokens(MatcherFirstTokens& firstTokens) const
+{
+    firstTokens.AddType(static_cast<int>(m_type));
+    return true;
+}
@@ -13,4 +13,6 @@ protected:
 
 public:
     explicit SimpleMatcherValueTypeAndHasSignPrefix(SimpleParserValueType type, bool hasSignPrefix);
+
+    bool CollectFirstTokens(MatcherFirstTokens& firstTokens) const override;
 };
@@ -14,7 +14,7 @@ SimpleLexer::MultiCharacterTokenLookupEntry::MultiCharacterTokenLookupEntry(cons
 
 SimpleLexer::SimpleLexer(IParserLineStream* stream)
     : AbstractLexer(stream),
-      m_config{false, true, false, true, true, {}},
+      m_config{false, true, false, true, true, false, {}},
       m_check_for_multi_character_tokens(false),
       m_last_line(1)
 {
@@ -30,6 +30,8 @@ SimpleLexer::SimpleLexer(IParserLineStream* stream, Config config)
         AddMultiCharacterTokenConfigToLookup(std::move(tokenConfig));
     m_config.m_multi_character_tokens.clear();
 
+    m_read_whole_input = m_config.m_read_whole_input;
+
     // If reading floating point numbers then must be reading integers
     assert(m_config.m_read_floating_point_numbers == false || m_config.m_read_floating_point_numbers == m_config.m_read_integer_numbers);
 }
@@ -64,14 +66,12 @@ bool SimpleLexer::ReadMultiCharacterToken(const MultiCharacterTokenLookupEntry*
     assert(!multiTokenLookup->m_value.empty());
     assert(currentLine.m_line[m_current_line_offset - 1] == multiTokenLookup->m_value[0]);
 
-    const char* linePos = &currentLine.m_line[m_current_line_offset - 1];
+    const auto tokenStart = m_current_line_offset - 1;
+    if (currentLine.m_line.size() - tokenStart < multiTokenLookup->m_value.size())
+        return false;
 
-    for (const auto c : multiTokenLookup->m_value)
-    {
-        if (!*linePos || *linePos != c)
-            return false;
-        linePos++;
-    }
+    if (currentLine.m_line.compare(tokenStart, multiTokenLookup->m_value.size(), multiTokenLookup->m_value) != 0)
+        return false;
 
     m_current_line_offset = m_current_line_offset - 1 + multiTokenLookup->m_value.size();
     return true;
@@ -121,7 +121,12 @@ SimpleParserValue SimpleLexer::GetNextToken()
     }
 
     if (m_config.m_read_strings && c == '\"')
-        return SimpleParserValue::String(pos, new std::string(m_config.m_string_escape_sequences ? ReadStringWithEscapeSequences() : ReadString()));
+    {
+        if (m_config.m_string_escape_sequences)
+            return SimpleParserValue::String(pos, m_symbol_table.Intern(ReadStringWithEscapeSequences()));
+
+        return SimpleParserValue::String(pos, m_symbol_table.Intern(ReadStringView()));
+    }
 
     if (m_config.m_read_integer_numbers && (isdigit(c) || (c == '+' || c == '-' || (m_config.m_read_floating_point_numbers && c == '.')) && isdigit(PeekChar())))
     {
@@ -146,11 +151,7 @@ SimpleParserValue SimpleLexer::GetNextToken()
     }
 
     if (isalpha(c) || c == '_')
-    {
-        auto identifier = ReadIdentifier();
-
-        return SimpleParserValue::Identifier(pos, new std::string(std::move(identifier)));
-    }
+        return SimpleParserValue::Identifier(pos, m_symbol_table.Intern(ReadIdentifierView()));
 
     return SimpleParserValue::Character(pos, static_cast<char>(c));
 }
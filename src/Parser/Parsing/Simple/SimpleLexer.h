@@ -5,6 +5,7 @@
 #include <memory>
 
 #include "SimpleParserValue.h"
+#include "SimpleSymbolTable.h"
 #include "Parsing/Impl/AbstractLexer.h"
 
 class SimpleLexer : public AbstractLexer<SimpleParserValue>
@@ -27,6 +28,11 @@ public:
         bool m_string_escape_sequences = false;
         bool m_read_integer_numbers = true;
         bool m_read_floating_point_numbers = true;
+
+        // Reads all lines of the stream up front instead of line by line.
+        // Only makes sense when nothing inspects the state of the stream while parsing.
+        bool m_read_whole_input = false;
+
         std::vector<MultiCharacterToken> m_multi_character_tokens;
     };
 
@@ -42,6 +48,7 @@ protected:
     };
 
     Config m_config;
+    SimpleSymbolTable m_symbol_table;
     bool m_check_for_multi_character_tokens;
     int m_last_line;
 
@@ -71,11 +71,30 @@ SimpleParserValue SimpleParserValue::String(const TokenPos pos, std::string* str
     return pv;
 }
 
+SimpleParserValue SimpleParserValue::String(const TokenPos pos, const SimpleSymbol& symbol)
+{
+    SimpleParserValue pv(pos, SimpleParserValueType::STRING);
+    pv.m_value.string_value = &symbol.m_value;
+    pv.m_interned = true;
+    return pv;
+}
+
 SimpleParserValue SimpleParserValue::Identifier(const TokenPos pos, std::string* identifier)
 {
     SimpleParserValue pv(pos, SimpleParserValueType::IDENTIFIER);
     pv.m_value.string_value = identifier;
     pv.m_hash = std::hash<std::string>()(*identifier);
+    pv.m_folded_hash = SimpleSymbolTable::CaseFoldedHash(*identifier);
+    return pv;
+}
+
+SimpleParserValue SimpleParserValue::Identifier(const TokenPos pos, const SimpleSymbol& symbol)
+{
+    SimpleParserValue pv(pos, SimpleParserValueType::IDENTIFIER);
+    pv.m_value.string_value = &symbol.m_value;
+    pv.m_hash = symbol.m_hash;
+    pv.m_folded_hash = symbol.m_folded_hash;
+    pv.m_interned = true;
     return pv;
 }
 
@@ -83,7 +102,9 @@ SimpleParserValue::SimpleParserValue(const TokenPos pos, const SimpleParserValue
     : m_pos(pos),
       m_type(type),
       m_hash(0),
+      m_folded_hash(0),
       m_has_sign_prefix(false),
+      m_interned(false),
       m_value{}
 {
 }
@@ -94,7 +115,8 @@ SimpleParserValue::~SimpleParserValue()
     {
     case SimpleParserValueType::STRING:
     case SimpleParserValueType::IDENTIFIER:
-        delete m_value.string_value;
+        if (!m_interned)
+            delete m_value.string_value;
         break;
 
     default:
@@ -108,7 +130,9 @@ SimpleParserValue::SimpleParserValue(SimpleParserValue&& other) noexcept
     : m_pos(other.m_pos),
       m_type(other.m_type),
       m_hash(other.m_hash),
+      m_folded_hash(other.m_folded_hash),
       m_has_sign_prefix(other.m_has_sign_prefix),
+      m_interned(other.m_interned),
       m_value(other.m_value)
 {
     other.m_value = ValueType();
@@ -120,7 +144,9 @@ SimpleParserValue& SimpleParserValue::operator=(SimpleParserValue&& other) noexc
     m_type = other.m_type;
     m_value = other.m_value;
     m_hash = other.m_hash;
+    m_folded_hash = other.m_folded_hash;
     m_has_sign_prefix = other.m_has_sign_prefix;
+    m_interned = other.m_interned;
     other.m_value = ValueType();
 
     return *this;
@@ -160,13 +186,13 @@ double SimpleParserValue::FloatingPointValue() const
     return m_value.double_value;
 }
 
-std::string& SimpleParserValue::StringValue() const
+const std::string& SimpleParserValue::StringValue() const
 {
     assert(m_type == SimpleParserValueType::STRING);
     return *m_value.string_value;
 }
 
-std::string& SimpleParserValue::IdentifierValue() const
+const std::string& SimpleParserValue::IdentifierValue() const
 {
     assert(m_type == SimpleParserValueType::IDENTIFIER);
     return *m_value.string_value;
@@ -177,3 +203,9 @@ size_t SimpleParserValue::IdentifierHash() const
     assert(m_type == SimpleParserValueType::IDENTIFIER);
     return m_hash;
 }
+
+size_t SimpleParserValue::IdentifierFoldedHash() const
+{
+    assert(m_type == SimpleParserValueType::IDENTIFIER);
+    return m_folded_hash;
+}
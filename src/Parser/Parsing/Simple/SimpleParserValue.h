@@ -5,6 +5,7 @@
 #include "Parsing/IParserValue.h"
 #include "Utils/ClassUtils.h"
 #include "Parsing/TokenPos.h"
+#include "SimpleSymbolTable.h"
 
 enum class SimpleParserValueType
 {
@@ -33,14 +34,17 @@ public:
     TokenPos m_pos;
     SimpleParserValueType m_type;
     size_t m_hash;
+    size_t m_folded_hash;
     bool m_has_sign_prefix;
+    // Interned values belong to the symbol table of the lexer and are not deleted with the token
+    bool m_interned;
     union ValueType
     {
         char char_value;
         int int_value;
         int multi_character_sequence_id;
         double double_value;
-        std::string* string_value;
+        const std::string* string_value;
     } m_value;
 
     static SimpleParserValue Invalid(TokenPos pos);
@@ -53,7 +57,9 @@ public:
     static SimpleParserValue FloatingPoint(TokenPos pos, double value);
     static SimpleParserValue FloatingPoint(TokenPos pos, double value, bool hasSignPrefix);
     static SimpleParserValue String(TokenPos pos, std::string* stringValue);
+    static SimpleParserValue String(TokenPos pos, const SimpleSymbol& symbol);
     static SimpleParserValue Identifier(TokenPos pos, std::string* identifier);
+    static SimpleParserValue Identifier(TokenPos pos, const SimpleSymbol& symbol);
 
 private:
     SimpleParserValue(TokenPos pos, SimpleParserValueType type);
@@ -72,7 +78,8 @@ public:
     _NODISCARD int MultiCharacterValue() const;
     _NODISCARD int IntegerValue() const;
     _NODISCARD double FloatingPointValue() const;
-    _NODISCARD std::string& StringValue() const;
-    _NODISCARD std::string& IdentifierValue() const;
+    _NODISCARD const std::string& StringValue() const;
+    _NODISCARD const std::string& IdentifierValue() const;
     _NODISCARD size_t IdentifierHash() const;
+    _NODISCARD size_t IdentifierFoldedHash() const;
 };
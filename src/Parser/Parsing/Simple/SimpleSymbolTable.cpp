@@ -0,0 +1,28 @@
+#include "SimpleSymbolTable.h"
+
+#include <cctype>
+
+size_t SimpleSymbolTable::CaseFoldedHash(const std::string_view value)
+{
+    // FNV-1a
+    size_t hash = 2166136261u;
+    for (const auto c : value)
+    {
+        hash ^= static_cast<size_t>(tolower(static_cast<unsigned char>(c)));
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+const SimpleSymbol& SimpleSymbolTable::Intern(const std::string_view value)
+{
+    const auto existingSymbol = m_symbol_lookup.find(value);
+    if (existingSymbol != m_symbol_lookup.end())
+        return *existingSymbol->second;
+
+    auto& symbol = m_symbols.emplace_back(SimpleSymbol{std::string(value), std::hash<std::string_view>()(value), CaseFoldedHash(value)});
+    m_symbol_lookup.emplace(symbol.m_value, &symbol);
+
+    return symbol;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "Utils/ClassUtils.h"
+
+class SimpleSymbol
+{
+public:
+    std::string m_value;
+    size_t m_hash;
+    size_t m_folded_hash;
+};
+
+/**
+ * \brief Stores each distinct identifier and string of a parse once so tokens can refer to it instead of owning a copy.
+ */
+class SimpleSymbolTable
+{
+    std::deque<SimpleSymbol> m_symbols;
+    std::unordered_map<std::string_view, const SimpleSymbol*> m_symbol_lookup;
+
+public:
+    SimpleSymbolTable() = default;
+    ~SimpleSymbolTable() = default;
+    SimpleSymbolTable(const SimpleSymbolTable& other) = delete;
+    SimpleSymbolTable(SimpleSymbolTable&& other) noexcept = default;
+    SimpleSymbolTable& operator=(const SimpleSymbolTable& other) = delete;
+    SimpleSymbolTable& operator=(SimpleSymbolTable&& other) noexcept = default;
+
+    /**
+     * \brief Hashes a value ignoring the case of its characters.
+     */
+    _NODISCARD static size_t CaseFoldedHash(std::string_view value);
+
+    /**
+     * \brief Returns the symbol for the value and adds it when it is not known yet. Symbols stay valid as long as the table exists.
+     */
+    const SimpleSymbol& Intern(std::string_view value);
+};
@@ -73,6 +73,20 @@ const CommandLineOption* const OPTION_MODEL_FORMAT =
     .WithParameter("modelFormatValue")
     .Build();
 
+const CommandLineOption* const OPTION_MODEL_THREADS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("model-threads")
+    .WithDescription("Specifies the amount of threads used to dump the lods of models. Defaults to the amount of hardware threads.")
+    .WithParameter("threadCount")
+    .Build();
+
+const CommandLineOption* const OPTION_MODEL_VERTEX_BUDGET =
+    CommandLineOption::Builder::Create()
+    .WithLongName("model-vertex-budget")
+    .WithDescription("Specifies the maximum amount of vertices of model lods that are dumped at the same time to limit memory usage. 0 removes the limit. Defaults to 4000000.")
+    .WithParameter("vertexCount")
+    .Build();
+
 const CommandLineOption* const OPTION_SKIP_OBJ =
     CommandLineOption::Builder::Create()
     .WithLongName("skip-obj")
@@ -118,6 +132,8 @@ const CommandLineOption* const COMMAND_LINE_OPTIONS[]
     OPTION_SEARCH_PATH,
     OPTION_IMAGE_FORMAT,
     OPTION_MODEL_FORMAT,
+    OPTION_MODEL_THREADS,
+    OPTION_MODEL_VERTEX_BUDGET,
     OPTION_SKIP_OBJ,
     OPTION_GDT,
     OPTION_EXCLUDE_ASSETS,
@@ -205,6 +221,38 @@ bool UnlinkerArgs::SetModelDumpingMode()
     return false;
 }
 
+bool UnlinkerArgs::SetModelDumpingThreadCount()
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_MODEL_THREADS);
+    char* endPtr;
+    const auto threadCount = strtol(specifiedValue.c_str(), &endPtr, 10);
+
+    if (specifiedValue.empty() || *endPtr != '\0' || threadCount <= 0)
+    {
+        printf("Illegal value: \"%s\" is not a valid thread count. Use -? to see usage information.\n", specifiedValue.c_str());
+        return false;
+    }
+
+    ObjWriting::Configuration.ModelDumpThreadCount = static_cast<unsigned>(threadCount);
+    return true;
+}
+
+bool UnlinkerArgs::SetModelDumpingVertexBudget()
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_MODEL_VERTEX_BUDGET);
+    char* endPtr;
+    const auto vertexBudget = strtoll(specifiedValue.c_str(), &endPtr, 10);
+
+    if (specifiedValue.empty() || *endPtr != '\0' || vertexBudget < 0)
+    {
+        printf("Illegal value: \"%s\" is not a valid vertex count. Use -? to see usage information.\n", specifiedValue.c_str());
+        return false;
+    }
+
+    ObjWriting::Configuration.ModelDumpVertexBudget = static_cast<size_t>(vertexBudget);
+    return true;
+}
+
 void UnlinkerArgs::AddSpecifiedAssetType(std::string value)
 {
     const auto alreadySpecifiedAssetType = m_specified_asset_type_map.find(value);
@@ -306,6 +354,24 @@ bool UnlinkerArgs::ParseArgs(const int argc, const char** argv)
         }
     }
 
+    // --model-threads
+    if (m_argument_parser.IsOptionSpecified(OPTION_MODEL_THREADS))
+    {
+        if (!SetModelDumpingThreadCount())
+        {
+            return false;
+        }
+    }
+
+    // --model-vertex-budget
+    if (m_argument_parser.IsOptionSpecified(OPTION_MODEL_VERTEX_BUDGET))
+    {
+        if (!SetModelDumpingVertexBudget())
+        {
+            return false;
+        }
+    }
+
     // --skip-obj
     m_skip_obj = m_argument_parser.IsOptionSpecified(OPTION_SKIP_OBJ);
 
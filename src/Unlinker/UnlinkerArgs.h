@@ -25,6 +25,8 @@ private:
     void SetVerbose(bool isVerbose);
     bool SetImageDumpingMode();
     bool SetModelDumpingMode();
+    bool SetModelDumpingThreadCount();
+    bool SetModelDumpingVertexBudget();
 
     void AddSpecifiedAssetType(std::string value);
     void ParseCommaSeparatedAssetTypeString(const std::string& input);
@@ -1,6 +1,14 @@
 #include "FileUtils.h"
 
 #include <sstream>
+#include <vector>
+
+#if defined(_WIN32) || defined(_WIN64) || defined(_MSC_VER)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <filesystem>
+#endif
 
 bool FileUtils::ParsePathsString(const std::string& pathsString, std::set<std::string>& output)
 {
@@ -61,3 +69,33 @@ bool FileUtils::ParsePathsString(const std::string& pathsString, std::set<std::s
 
     return true;
 }
+
+bool FileUtils::GetExecutablePath(std::string& executablePath)
+{
+#if defined(_WIN32) || defined(_WIN64) || defined(_MSC_VER)
+    std::vector<char> buffer(MAX_PATH);
+    while (true)
+    {
+        const auto length = GetModuleFileNameA(nullptr, buffer.data(), static_cast<DWORD>(buffer.size()));
+        if (length == 0)
+            return false;
+
+        // The path is truncated when the buffer is too small
+        if (length < buffer.size())
+        {
+            executablePath.assign(buffer.data(), length);
+            return true;
+        }
+
+        buffer.resize(buffer.size() * 2);
+    }
+#else
+    std::error_code ec;
+    const auto path = std::filesystem::read_symlink("/proc/self/exe", ec);
+    if (ec)
+        return false;
+
+    executablePath = path.string();
+    return true;
+#endif
+}
@@ -21,4 +21,11 @@ public:
      * \return \c true if the user input was valid and could be processed successfully, otherwise \c false.
      */
     static bool ParsePathsString(const std::string& pathsString, std::set<std::string>& output);
+
+    /**
+     * \brief Gets the path of the executable of the running process.
+     * \param executablePath The string to save the path to.
+     * \return \c true if the path could be determined, otherwise \c false.
+     */
+    static bool GetExecutablePath(std::string& executablePath);
 };
@@ -0,0 +1,144 @@
+#include "TaskPool.h"
+
+#include <algorithm>
+
+std::atomic_uint TaskPool::s_default_thread_count(0u);
+
+TaskPool::QueuedTask::QueuedTask(std::function<void()> task, const size_t cost)
+    : m_task(std::move(task)),
+      m_cost(cost)
+{
+}
+
+TaskPool::TaskPool(const unsigned threadCount, const size_t costBudget)
+    : m_cost_budget(costBudget),
+      m_cost_in_flight(0u),
+      m_tasks_in_flight(0u),
+      m_stopping(false)
+{
+    if (threadCount <= 1)
+        return;
+
+    m_threads.reserve(threadCount);
+    for (auto threadIndex = 0u; threadIndex < threadCount; threadIndex++)
+        m_threads.emplace_back(&TaskPool::WorkerLoop, this);
+}
+
+TaskPool::~TaskPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_task_finished.wait(lock, [this]
+        {
+            return m_tasks_in_flight == 0u;
+        });
+        m_stopping = true;
+    }
+
+    m_task_available.notify_all();
+    for (auto& thread : m_threads)
+        thread.join();
+}
+
+unsigned TaskPool::HardwareThreadCount()
+{
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+unsigned TaskPool::DefaultThreadCount()
+{
+    const auto defaultThreadCount = s_default_thread_count.load();
+    return defaultThreadCount > 0u ? defaultThreadCount : HardwareThreadCount();
+}
+
+void TaskPool::SetDefaultThreadCount(const unsigned threadCount)
+{
+    s_default_thread_count = threadCount;
+}
+
+unsigned TaskPool::GetThreadCount() const
+{
+    return std::max(static_cast<unsigned>(m_threads.size()), 1u);
+}
+
+void TaskPool::WorkerLoop()
+{
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_task_available.wait(lock, [this]
+        {
+            return m_stopping || !m_queue.empty();
+        });
+
+        if (m_queue.empty())
+            return;
+
+        auto task = std::move(m_queue.front());
+        m_queue.pop_front();
+        lock.unlock();
+
+        std::exception_ptr exception;
+        try
+        {
+            task.m_task();
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        lock.lock();
+        if (exception && !m_first_exception)
+            m_first_exception = exception;
+        m_cost_in_flight -= task.m_cost;
+        m_tasks_in_flight--;
+        lock.unlock();
+
+        m_task_finished.notify_all();
+    }
+}
+
+void TaskPool::Enqueue(std::function<void()> task, const size_t cost)
+{
+    if (m_threads.empty())
+    {
+        task();
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        // A task that is more expensive than the whole budget still has to be able to run on its own
+        if (m_cost_budget != UNLIMITED_COST_BUDGET)
+        {
+            m_task_finished.wait(lock, [this, cost]
+            {
+                return m_tasks_in_flight == 0u || m_cost_in_flight + cost <= m_cost_budget;
+            });
+        }
+
+        m_cost_in_flight += cost;
+        m_tasks_in_flight++;
+        m_queue.emplace_back(std::move(task), cost);
+    }
+
+    m_task_available.notify_one();
+}
+
+void TaskPool::WaitForCompletion()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_task_finished.wait(lock, [this]
+    {
+        return m_tasks_in_flight == 0u;
+    });
+
+    if (m_first_exception)
+    {
+        const auto exception = m_first_exception;
+        m_first_exception = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ClassUtils.h"
+
+/**
+ * \brief A fixed size pool of worker threads executing queued tasks.
+ * Every task has a cost and the pool never has more than its cost budget worth of tasks queued or running at once.
+ * Enqueuing a task that exceeds the remaining budget blocks until enough running tasks finished.
+ * A pool with a single thread runs all tasks synchronously on the enqueuing thread.
+ */
+class TaskPool
+{
+public:
+    static constexpr size_t UNLIMITED_COST_BUDGET = 0u;
+
+private:
+    static std::atomic_uint s_default_thread_count;
+
+    class QueuedTask
+    {
+    public:
+        std::function<void()> m_task;
+        size_t m_cost;
+
+        QueuedTask(std::function<void()> task, size_t cost);
+    };
+
+    size_t m_cost_budget;
+    size_t m_cost_in_flight;
+    size_t m_tasks_in_flight;
+    bool m_stopping;
+    std::exception_ptr m_first_exception;
+
+    std::deque<QueuedTask> m_queue;
+    std::vector<std::thread> m_threads;
+
+    std::mutex m_mutex;
+    std::condition_variable m_task_available;
+    std::condition_variable m_task_finished;
+
+    void WorkerLoop();
+
+public:
+    explicit TaskPool(unsigned threadCount, size_t costBudget = UNLIMITED_COST_BUDGET);
+    ~TaskPool();
+    TaskPool(const TaskPool& other) = delete;
+    TaskPool(TaskPool&& other) noexcept = delete;
+    TaskPool& operator=(const TaskPool& other) = delete;
+    TaskPool& operator=(TaskPool&& other) noexcept = delete;
+
+    /**
+     * \brief Returns the amount of hardware threads or 1 if it is unknown.
+     */
+    static unsigned HardwareThreadCount();
+
+    /**
+     * \brief Returns the amount of threads to use when the user did not specify any: The amount set with SetDefaultThreadCount or otherwise the amount of hardware threads.
+     */
+    static unsigned DefaultThreadCount();
+
+    /**
+     * \brief Sets the amount of threads pools use by default. Useful when multiple pools that use the default run at the same time and have to share the hardware threads.
+     * \param threadCount The amount of threads or 0 to use the amount of hardware threads.
+     */
+    static void SetDefaultThreadCount(unsigned threadCount);
+
+    _NODISCARD unsigned GetThreadCount() const;
+
+    void Enqueue(std::function<void()> task, size_t cost = 0u);
+
+    /**
+     * \brief Waits until all enqueued tasks are done.
+     * If any of the tasks threw an exception the first one is rethrown.
+     */
+    void WaitForCompletion();
+};
@@ -1,11 +1,15 @@
 #pragma once
 
 #include "AssetPool.h"
-#include "GlobalAssetPool.h"
 #include "XAssetInfo.h"
 
 #include <cstring>
 
+/**
+ * \brief A pool for assets of a zone that is being created.
+ * Unlike the pools of loaded zones it is not linked to the global asset pools: Its assets only belong to the zone being created and must not be picked up by other zones,
+ * which also allows creating multiple zones at once.
+ */
 template <typename T>
 class AssetPoolDynamic final : public AssetPool<T>
 {
@@ -17,7 +21,6 @@ class AssetPoolDynamic final : public AssetPool<T>
 public:
     AssetPoolDynamic(const int priority, const asset_type_t type)
     {
-        GlobalAssetPool<T>::LinkAssetPool(this, priority);
         m_type = type;
     }
 
@@ -28,8 +31,6 @@ public:
 
     ~AssetPoolDynamic() override
     {
-        GlobalAssetPool<T>::UnlinkAssetPool(this);
-
         for(auto* entry : m_assets)
         {
             delete entry->Asset();
@@ -55,8 +56,6 @@ public:
         
         m_assets.push_back(newInfo);
         m_asset_lookup[newInfo->m_name] = newInfo;
-       
-        GlobalAssetPool<T>::LinkAsset(this, newInfo);
 
         return newInfo;
     }
@@ -5,21 +5,19 @@ AssetListInputStream::AssetListInputStream(std::istream& stream)
 {
 }
 
-bool AssetListInputStream::NextEntry(AssetListEntry& entry) const
+bool AssetListInputStream::NextEntry(AssetListEntry& entry)
 {
-    std::vector<std::string> row;
-
     while(true)
     {
-        if (!m_stream.NextRow(row))
+        if (!m_stream.NextRow(m_row))
             return false;
 
-        if (row.empty())
+        if (m_row.empty())
             continue;
 
-        entry.m_type = row[0];
-        if (row.size() >= 2)
-            entry.m_name = row[1];
+        entry.m_type = m_row[0];
+        if (m_row.size() >= 2)
+            entry.m_name = m_row[1];
         return true;
     }
 }
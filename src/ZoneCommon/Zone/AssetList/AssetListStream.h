@@ -7,11 +7,12 @@
 class AssetListInputStream
 {
     CsvInputStream m_stream;
+    std::vector<std::string_view> m_row;
 
 public:
     explicit AssetListInputStream(std::istream& stream);
 
-    bool NextEntry(AssetListEntry& entry) const;
+    bool NextEntry(AssetListEntry& entry);
 };
 
 class AssetListOutputStream
@@ -1,5 +1,6 @@
 #include "OutputProcessorXChunks.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 
@@ -15,7 +16,23 @@ void OutputProcessorXChunks::Init()
     m_initialized = true;
 }
 
-void OutputProcessorXChunks::WriteChunk()
+OutputProcessorXChunks::PendingChunk::PendingChunk(const size_t chunkSize)
+    : m_input_buffer(std::make_unique<uint8_t[]>(chunkSize)),
+      m_output_buffer(std::make_unique<uint8_t[]>(chunkSize)),
+      m_input_size(0)
+{
+}
+
+void OutputProcessorXChunks::ProcessChunk(const int streamNumber, PendingChunk& chunk) const
+{
+    for (const auto& processor : m_chunk_processors)
+    {
+        chunk.m_input_size = processor->Process(streamNumber, chunk.m_input_buffer.get(), chunk.m_input_size, chunk.m_output_buffer.get(), m_chunk_size);
+        std::swap(chunk.m_input_buffer, chunk.m_output_buffer);
+    }
+}
+
+void OutputProcessorXChunks::WriteChunk(const PendingChunk& chunk)
 {
     if (m_vanilla_buffer_size > 0)
     {
@@ -27,33 +44,50 @@ void OutputProcessorXChunks::WriteChunk()
         }
     }
 
+    auto chunkSize = static_cast<xchunk_size_t>(chunk.m_input_size);
+    m_base_stream->Write(&chunkSize, sizeof(chunkSize));
+    m_base_stream->Write(chunk.m_input_buffer.get(), chunk.m_input_size);
+
+    if (m_vanilla_buffer_size > 0)
+    {
+        m_vanilla_buffer_offset += sizeof(chunkSize) + chunk.m_input_size;
+        m_vanilla_buffer_offset %= m_vanilla_buffer_size;
+    }
+}
+
+void OutputProcessorXChunks::WritePendingChunks()
+{
+    if (m_filled_chunk_count <= 0)
+        return;
+
     try
     {
-        for (const auto& processor : m_chunk_processors)
+        for (auto chunkIndex = 0; chunkIndex < m_filled_chunk_count; chunkIndex++)
         {
-            m_input_size = processor->Process(m_current_stream, m_input_buffer, m_input_size, m_output_buffer, m_chunk_size);
-            auto* swap = m_input_buffer;
-            m_input_buffer = m_output_buffer;
-            m_output_buffer = swap;
+            const auto streamNumber = (m_current_stream + chunkIndex) % m_stream_count;
+            auto* chunk = &m_pending_chunks[chunkIndex];
+            m_task_pool->Enqueue([this, streamNumber, chunk]
+            {
+                ProcessChunk(streamNumber, *chunk);
+            });
         }
+
+        m_task_pool->WaitForCompletion();
     }
     catch (XChunkException& e)
     {
         throw WritingException(e.Message());
     }
 
-    auto chunkSize = static_cast<xchunk_size_t>(m_input_size);
-    m_base_stream->Write(&chunkSize, sizeof(chunkSize));
-    m_base_stream->Write(m_input_buffer, m_input_size);
-
-    if (m_vanilla_buffer_size > 0)
+    for (auto chunkIndex = 0; chunkIndex < m_filled_chunk_count; chunkIndex++)
     {
-        m_vanilla_buffer_offset += sizeof(chunkSize) + m_input_size;
-        m_vanilla_buffer_offset %= m_vanilla_buffer_size;
+        auto& chunk = m_pending_chunks[chunkIndex];
+        WriteChunk(chunk);
+        chunk.m_input_size = 0;
     }
 
-    m_current_stream = (m_current_stream + 1) % m_stream_count;
-    m_input_size = 0;
+    m_current_stream = (m_current_stream + m_filled_chunk_count) % m_stream_count;
+    m_filled_chunk_count = 0;
 }
 
 OutputProcessorXChunks::OutputProcessorXChunks(const int numStreams, const size_t xChunkSize, const size_t xChunkWriteSize)
@@ -64,19 +98,15 @@ OutputProcessorXChunks::OutputProcessorXChunks(const int numStreams, const size_
       m_initialized(false),
       m_current_stream(0),
       m_vanilla_buffer_offset(0),
-      m_input_buffer(nullptr),
-      m_output_buffer(nullptr),
-      m_input_size(0)
+      m_filled_chunk_count(0),
+      m_task_pool(std::make_unique<TaskPool>(std::min(static_cast<unsigned>(numStreams), TaskPool::DefaultThreadCount())))
 {
     assert(numStreams > 0);
     assert(xChunkSize > 0);
     assert(m_chunk_size >= m_chunk_write_size);
 
-    for (auto i = 0u; i < 2u; i++)
-        m_buffers.emplace_back(std::make_unique<uint8_t[]>(xChunkSize));
-
-    m_input_buffer = m_buffers[0].get();
-    m_output_buffer = m_buffers[1].get();
+    for (auto i = 0; i < numStreams; i++)
+        m_pending_chunks.emplace_back(xChunkSize);
 }
 
 OutputProcessorXChunks::OutputProcessorXChunks(const int numStreams, const size_t xChunkSize, const size_t xChunkWriteSize, const size_t vanillaBufferSize)
@@ -102,12 +132,13 @@ void OutputProcessorXChunks::Write(const void* buffer, const size_t length)
     auto sizeRemaining = length;
     while (sizeRemaining > 0)
     {
-        const auto toWrite = std::min(m_chunk_write_size - m_input_size, sizeRemaining);
+        auto& chunk = m_pending_chunks[m_filled_chunk_count];
+        const auto toWrite = std::min(m_chunk_write_size - chunk.m_input_size, sizeRemaining);
 
-        memcpy(&m_input_buffer[m_input_size], &static_cast<const char*>(buffer)[length - sizeRemaining], toWrite);
-        m_input_size += toWrite;
-        if (m_input_size >= m_chunk_write_size)
-            WriteChunk();
+        memcpy(&chunk.m_input_buffer[chunk.m_input_size], &static_cast<const char*>(buffer)[length - sizeRemaining], toWrite);
+        chunk.m_input_size += toWrite;
+        if (chunk.m_input_size >= m_chunk_write_size && ++m_filled_chunk_count >= m_stream_count)
+            WritePendingChunks();
 
         sizeRemaining -= toWrite;
     }
@@ -115,8 +146,10 @@ void OutputProcessorXChunks::Write(const void* buffer, const size_t length)
 
 void OutputProcessorXChunks::Flush()
 {
-    if (m_input_size)
-        WriteChunk();
+    if (m_filled_chunk_count < m_stream_count && m_pending_chunks[m_filled_chunk_count].m_input_size > 0)
+        m_filled_chunk_count++;
+
+    WritePendingChunks();
 
     m_base_stream->Flush();
 }
@@ -4,11 +4,26 @@
 #include <cstdint>
 #include <cstddef>
 
+#include "Utils/TaskPool.h"
 #include "Writing/OutputStreamProcessor.h"
 #include "Zone/XChunk/IXChunkProcessor.h"
 
+/**
+ * \brief Writes data in XChunks that are distributed over a number of streams in turn.
+ * Every stream is processed independently, so one chunk of every stream is collected and all of them are processed concurrently before being written in order.
+ */
 class OutputProcessorXChunks final : public OutputStreamProcessor
 {
+    class PendingChunk
+    {
+    public:
+        std::unique_ptr<uint8_t[]> m_input_buffer;
+        std::unique_ptr<uint8_t[]> m_output_buffer;
+        size_t m_input_size;
+
+        explicit PendingChunk(size_t chunkSize);
+    };
+
     std::vector<std::unique_ptr<IXChunkProcessor>> m_chunk_processors;
 
     int m_stream_count;
@@ -20,13 +35,15 @@ class OutputProcessorXChunks final : public OutputStreamProcessor
     int m_current_stream;
     size_t m_vanilla_buffer_offset;
 
-    std::vector<std::unique_ptr<uint8_t[]>> m_buffers;
-    uint8_t* m_input_buffer;
-    uint8_t* m_output_buffer;
-    size_t m_input_size;
+    // One chunk for every stream. Chunks before m_filled_chunk_count are complete and wait to be processed.
+    std::vector<PendingChunk> m_pending_chunks;
+    int m_filled_chunk_count;
+    std::unique_ptr<TaskPool> m_task_pool;
 
     void Init();
-    void WriteChunk();
+    void ProcessChunk(int streamNumber, PendingChunk& chunk) const;
+    void WriteChunk(const PendingChunk& chunk);
+    void WritePendingChunks();
 
 public:
     OutputProcessorXChunks(int numStreams, size_t xChunkSize, size_t xChunkWriteSize);
@@ -7,8 +7,13 @@ StepWriteZoneContentToFile::StepWriteZoneContentToFile(StepWriteZoneContentToMem
 
 void StepWriteZoneContentToFile::PerformStep(ZoneWriter* zoneWriter, IWritingStream* stream)
 {
-    for(const auto& dataBuffer : m_memory->GetData()->m_buffers)
+    for (auto& dataBuffer : m_memory->GetData()->m_buffers)
     {
         stream->Write(dataBuffer.m_data.get(), dataBuffer.m_size);
+
+        // Every buffer is only written once so its memory can already be released while the remaining ones are being processed.
+        // This does not lower the peak memory usage, which is reached once the whole zone content was written to memory,
+        // but hands the memory back earlier to other zones that are being built at the same time.
+        dataBuffer.m_data.reset();
     }
 }
@@ -0,0 +1,61 @@
+LinkerTests = {}
+
+function LinkerTests:include(includes)
+	if includes:handle(self:name()) then
+		includedirs {
+			path.join(TestFolder(), "LinkerTests")
+		}
+	end
+end
+
+function LinkerTests:link(links)
+	
+end
+
+function LinkerTests:use()
+	
+end
+
+function LinkerTests:name()
+    return "LinkerTests"
+end
+
+function LinkerTests:project()
+	local folder = TestFolder()
+	local includes = Includes:create()
+	local links = Links:create()
+
+	project(self:name())
+        targetdir(TargetDirectoryTest)
+		location "%{wks.location}/test/%{prj.name}"
+		kind "ConsoleApp"
+		language "C++"
+		
+		-- The linker is an executable, so the tested parts of it are built into the tests directly
+		files {
+			path.join(folder, "LinkerTests/**.h"), 
+			path.join(folder, "LinkerTests/**.cpp"),
+			path.join(folder, "ObjLoadingTests/Mock/MockSearchPath.h"),
+			path.join(folder, "ObjLoadingTests/Mock/MockSearchPath.cpp"),
+			path.join(ProjectFolder(), "Linker/BuildCache/**.h"),
+			path.join(ProjectFolder(), "Linker/BuildCache/**.cpp")
+		}
+		
+        vpaths {
+			["*"] = {
+				path.join(folder, "LinkerTests")
+			}
+		}
+		
+		self:include(includes)
+		Linker:include(includes)
+		ObjLoadingTests:include(includes)
+		ObjLoading:include(includes)
+		Crypto:include(includes)
+		catch2:include(includes)
+
+		links:linkto(ObjLoading)
+		links:linkto(Crypto)
+		links:linkto(catch2)
+		links:linkall()
+end
@@ -0,0 +1,188 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+
+#include "BuildCache/ProjectBuildCache.h"
+#include "Mock/MockSearchPath.h"
+
+namespace fs = std::filesystem;
+
+namespace test::linker::build_cache
+{
+    const std::vector<std::string> TEST_SETTINGS{"linker 1234", "menu-permissive 0"};
+
+    class BuildCacheTestFiles
+    {
+    public:
+        BuildCacheTestFiles()
+            : m_directory(fs::temp_directory_path() / "OatProjectBuildCacheTests")
+        {
+            fs::create_directories(m_directory);
+            m_cache_file_path = (m_directory / "test.cache").string();
+            m_output_file_path = (m_directory / "test.ff").string();
+
+            std::ofstream outputFile(m_output_file_path, std::fstream::out | std::fstream::binary);
+            outputFile << "zone";
+        }
+
+        ~BuildCacheTestFiles()
+        {
+            std::error_code ec;
+            fs::remove_all(m_directory, ec);
+        }
+
+        BuildCacheTestFiles(const BuildCacheTestFiles& other) = delete;
+        BuildCacheTestFiles(BuildCacheTestFiles&& other) noexcept = delete;
+        BuildCacheTestFiles& operator=(const BuildCacheTestFiles& other) = delete;
+        BuildCacheTestFiles& operator=(BuildCacheTestFiles&& other) noexcept = delete;
+
+        fs::path m_directory;
+        std::string m_cache_file_path;
+        std::string m_output_file_path;
+    };
+
+    /**
+     * \brief Builds a project that reads the first few bytes of every specified file and writes the build cache for it.
+     */
+    void WriteBuildCache(const BuildCacheTestFiles& files, ISearchPath* searchPath, const std::vector<std::string>& readFiles)
+    {
+        BuildInputRecordingSearchPath recordingSearchPath(searchPath);
+        for (const auto& fileName : readFiles)
+        {
+            const auto file = recordingSearchPath.Open(fileName);
+            if (file.IsOpen())
+            {
+                // Reading only a part of the file still has to record the hash of the whole file
+                char buffer[4];
+                file.m_stream->read(buffer, sizeof(buffer));
+            }
+        }
+
+        const ProjectBuildCache buildCache(files.m_cache_file_path, TEST_SETTINGS);
+        const std::map<std::string, BuildInputRecordingSearchPath*> buildInputs{{"assets", &recordingSearchPath}};
+        REQUIRE(buildCache.Write(buildInputs, files.m_output_file_path));
+    }
+
+    bool IsUpToDate(const BuildCacheTestFiles& files, ISearchPath* searchPath, const std::vector<std::string>& settings = TEST_SETTINGS)
+    {
+        BuildInputRecordingSearchPath recordingSearchPath(searchPath);
+        const ProjectBuildCache buildCache(files.m_cache_file_path, settings);
+        const std::map<std::string, BuildInputRecordingSearchPath*> buildInputs{{"assets", &recordingSearchPath}};
+
+        return buildCache.IsUpToDate(buildInputs);
+    }
+
+    TEST_CASE("ProjectBuildCache: Is up to date when nothing changed", "[linker][buildcache]")
+    {
+        const BuildCacheTestFiles files;
+        MockSearchPath searchPath;
+        searchPath.AddFileData("maps/test.gsc", "main() { level.test = 1; }");
+        WriteBuildCache(files, &searchPath, {"maps/test.gsc", "maps/missing.gsc"});
+
+        REQUIRE(IsUpToDate(files, &searchPath));
+    }
+
+    TEST_CASE("ProjectBuildCache: Is not up to date when an input changed", "[linker][buildcache]")
+    {
+        const BuildCacheTestFiles files;
+        MockSearchPath searchPath;
+        searchPath.AddFileData("maps/test.gsc", "main() { level.test = 1; }");
+        WriteBuildCache(files, &searchPath, {"maps/test.gsc"});
+
+        // The change is after the part of the file that was read during the build
+        MockSearchPath changedSearchPath;
+        changedSearchPath.AddFileData("maps/test.gsc", "main() { level.test = 2; }");
+
+        REQUIRE(!IsUpToDate(files, &changedSearchPath));
+    }
+
+    TEST_CASE("ProjectBuildCache: Is not up to date when an input is missing", "[linker][buildcache]")
+    {
+        const BuildCacheTestFiles files;
+        MockSearchPath searchPath;
+        searchPath.AddFileData("maps/test.gsc", "main() { level.test = 1; }");
+        WriteBuildCache(files, &searchPath, {"maps/test.gsc"});
+
+        MockSearchPath emptySearchPath;
+
+        REQUIRE(!IsUpToDate(files, &emptySearchPath));
+    }
+
+    TEST_CASE("ProjectBuildCache: Is not up to date when a missing input appeared", "[linker][buildcache]")
+    {
+        const BuildCacheTestFiles files;
+        MockSearchPath emptySearchPath;
+        WriteBuildCache(files, &emptySearchPath, {"maps/test.gsc"});
+
+        MockSearchPath searchPath;
+        searchPath.AddFileData("maps/test.gsc", "main() { level.test = 1; }");
+
+        REQUIRE(IsUpToDate(files, &emptySearchPath));
+        REQUIRE(!IsUpToDate(files, &searchPath));
+    }
+
+    TEST_CASE("ProjectBuildCache: Is not up to date when the settings changed", "[linker][buildcache]")
+    {
+        const BuildCacheTestFiles files;
+        MockSearchPath searchPath;
+        searchPath.AddFileData("maps/test.gsc", "main() { level.test = 1; }");
+        WriteBuildCache(files, &searchPath, {"maps/test.gsc"});
+
+        REQUIRE(!IsUpToDate(files, &searchPath, {"linker 5678", "menu-permissive 0"}));
+        REQUIRE(!IsUpToDate(files, &searchPath, {"linker 1234", "menu-permissive 1"}));
+        REQUIRE(!IsUpToDate(files, &searchPath, {"linker 1234"}));
+        REQUIRE(!IsUpToDate(files, &searchPath, {"linker 1234", "menu-permissive 0", "menu-no-optimization 0"}));
+    }
+
+    TEST_CASE("ProjectBuildCache: Is not up to date when the output changed", "[linker][buildcache]")
+    {
+        const BuildCacheTestFiles files;
+        MockSearchPath searchPath;
+        searchPath.AddFileData("maps/test.gsc", "main() { level.test = 1; }");
+        WriteBuildCache(files, &searchPath, {"maps/test.gsc"});
+
+        {
+            std::ofstream outputFile(files.m_output_file_path, std::fstream::out | std::fstream::binary);
+            outputFile << "changed zone";
+        }
+
+        REQUIRE(!IsUpToDate(files, &searchPath));
+    }
+
+    TEST_CASE("BuildInputRecordingSearchPath: Records the hash of the whole file when seeking", "[linker][buildcache]")
+    {
+        const std::string content = "0123456789abcdefghijklmnopqrstuvwxyz";
+        MockSearchPath searchPath;
+        searchPath.AddFileData("test.bin", content);
+
+        BuildInputRecordingSearchPath recordingSearchPath(&searchPath);
+        {
+            const auto file = recordingSearchPath.Open("test.bin");
+            REQUIRE(file.IsOpen());
+
+            char buffer[4];
+            file.m_stream->seekg(10);
+            file.m_stream->read(buffer, sizeof(buffer));
+            REQUIRE(std::string(buffer, sizeof(buffer)) == "abcd");
+
+            file.m_stream->seekg(2);
+            file.m_stream->read(buffer, sizeof(buffer));
+            REQUIRE(std::string(buffer, sizeof(buffer)) == "2345");
+
+            file.m_stream->seekg(-4, std::ios::end);
+            file.m_stream->read(buffer, sizeof(buffer));
+            REQUIRE(std::string(buffer, sizeof(buffer)) == "wxyz");
+        }
+
+        // Opening the file again does not record it a second time
+        recordingSearchPath.Open("test.bin");
+
+        const auto& openedFiles = recordingSearchPath.GetOpenedFiles();
+        REQUIRE(openedFiles.size() == 1u);
+        REQUIRE(openedFiles[0].m_name == "test.bin");
+        REQUIRE(openedFiles[0].m_hash == ProjectBuildCache::HashData(content.data(), content.size()));
+    }
+}
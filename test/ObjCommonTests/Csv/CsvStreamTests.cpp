@@ -0,0 +1,81 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <sstream>
+
+#include "Csv/CsvStream.h"
+
+namespace csv_stream
+{
+	TEST_CASE("CsvInputStream: Ensure can read simple rows", "[csv]")
+	{
+		std::istringstream ss("hello,world\r\n"
+			"\n"
+			"one,,three\n"
+			"last");
+		CsvInputStream csv(ss);
+		std::vector<std::string> row;
+
+		REQUIRE(csv.NextRow(row));
+		REQUIRE(row == std::vector<std::string>{"hello", "world"});
+
+		REQUIRE(csv.NextRow(row));
+		REQUIRE(row == std::vector<std::string>{""});
+
+		REQUIRE(csv.NextRow(row));
+		REQUIRE(row == std::vector<std::string>{"one", "", "three"});
+
+		REQUIRE(csv.NextRow(row));
+		REQUIRE(row == std::vector<std::string>{"last"});
+
+		REQUIRE(!csv.NextRow(row));
+	}
+
+	TEST_CASE("CsvInputStream: Ensure can read quoted cells", "[csv]")
+	{
+		std::istringstream ss("\"with,separator\",\"with \"\"quotes\"\"\",not\"quoted\"\n"
+			"\"multiple\nlines\",end\n");
+		CsvInputStream csv(ss);
+		std::vector<std::string_view> row;
+
+		REQUIRE(csv.NextRow(row));
+		REQUIRE(row.size() == 3);
+		REQUIRE(row[0] == "with,separator");
+		REQUIRE(row[1] == "with \"quotes\"");
+		REQUIRE(row[2] == "not\"quoted\"");
+
+		REQUIRE(csv.NextRow(row));
+		REQUIRE(row.size() == 2);
+		REQUIRE(row[0] == "multiple\nlines");
+		REQUIRE(row[1] == "end");
+
+		REQUIRE(!csv.NextRow(row));
+	}
+
+	TEST_CASE("CsvInputStream: Ensure can read what CsvOutputStream writes", "[csv]")
+	{
+		const std::vector<std::vector<std::string>> rows{
+			{"plain", "with,separator", "with \"quotes\""},
+			{std::string(0x18000, 'a'), "", "after long cell"},
+		};
+
+		std::ostringstream out;
+		CsvOutputStream outCsv(out);
+		for (const auto& row : rows)
+		{
+			for (const auto& cell : row)
+				outCsv.WriteColumn(cell);
+			outCsv.NextRow();
+		}
+
+		std::istringstream in(out.str());
+		CsvInputStream inCsv(in);
+		std::vector<std::string> row;
+		for (const auto& expectedRow : rows)
+		{
+			REQUIRE(inCsv.NextRow(row));
+			REQUIRE(row == expectedRow);
+		}
+
+		REQUIRE(!inCsv.NextRow(row));
+	}
+}
@@ -338,4 +338,32 @@ namespace obj::gdt
 			REQUIRE(entry.m_properties.at("hello") == "very\nkewl\\stuff");
 		}
 	}
+
+	TEST_CASE("Gdt: Ensure can parse values that are larger than the read buffer", "[gdt]")
+	{
+		const std::string longValue(0x18000, 'a');
+		std::string gdtString = "{\n"
+		"\t\"test_entry\" ( \"test.gdf\" )\n"
+		"\t{\n"
+		"\t\t\"longkey\" \"" + longValue + "\"\n"
+		"\t\t\"escapedkey\" \"" + longValue + "\\\\" + longValue + "\\n\"\n"
+		"\t}\n"
+		"}";
+		std::istringstream ss(gdtString);
+
+		Gdt gdt;
+		GdtReader reader(ss);
+		REQUIRE(reader.Read(gdt));
+
+		REQUIRE(gdt.m_entries.size() == 1);
+
+		{
+			const auto& entry = *gdt.m_entries[0];
+			REQUIRE(entry.m_name == "test_entry");
+			REQUIRE(entry.m_properties.size() == 2);
+
+			REQUIRE(entry.m_properties.at("longkey") == longValue);
+			REQUIRE(entry.m_properties.at("escapedkey") == longValue + "\\" + longValue + "\n");
+		}
+	}
 }
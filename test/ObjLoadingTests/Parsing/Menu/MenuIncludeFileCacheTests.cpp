@@ -0,0 +1,147 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <sstream>
+#include <string>
+
+#include "Mock/MockSearchPath.h"
+#include "Parsing/Menu/MenuFileReader.h"
+#include "Parsing/Menu/MenuIncludeFileCache.h"
+
+using namespace menu;
+using namespace std::literals;
+
+namespace test::parsing::menu::include_file_cache
+{
+    constexpr auto INCLUDED_MENU = R"testmenu(
+menuDef
+{
+    name MENU_NAME
+    style MENU_STYLE
+}
+)testmenu";
+
+    std::unique_ptr<ParsingResult> ReadMenuFile(const std::string& fileName, const std::string& data, MenuAssetZoneState& zoneState, ISearchPath* searchPath, int* openedIncludeCount = nullptr)
+    {
+        std::istringstream ss(data);
+        auto* includeFileCache = &zoneState.m_include_file_cache;
+        MenuFileReader reader(ss, fileName, FeatureLevel::IW4, [includeFileCache, searchPath, openedIncludeCount](const std::string& filename, const std::string& sourceFile) -> std::unique_ptr<std::istream>
+        {
+            if (openedIncludeCount)
+                (*openedIncludeCount)++;
+
+            return includeFileCache->Open(filename, searchPath);
+        }, &includeFileCache->GetPreprocessedIncludes());
+
+        reader.IncludeZoneState(&zoneState);
+
+        return reader.ReadMenuFile();
+    }
+
+    TEST_CASE("MenuIncludeFileCache: File included twice with different defines gives different menus", "[parsing][menu]")
+    {
+        MockSearchPath searchPath;
+        searchPath.AddFileData("ui/menu.inc", INCLUDED_MENU);
+        MenuAssetZoneState zoneState;
+
+        const auto result = ReadMenuFile("test.menu", R"testmenu(
+{
+#define MENU_NAME "First"
+#define MENU_STYLE 1
+#include "ui/menu.inc"
+#undef MENU_NAME
+#undef MENU_STYLE
+#define MENU_NAME "Second"
+#define MENU_STYLE 2
+#include "ui/menu.inc"
+}
+)testmenu", zoneState, &searchPath);
+
+        REQUIRE(result);
+        REQUIRE(result->m_menus.size() == 2);
+
+        REQUIRE(result->m_menus[0]->m_name == "First"s);
+        REQUIRE(result->m_menus[0]->m_style == 1);
+
+        REQUIRE(result->m_menus[1]->m_name == "Second"s);
+        REQUIRE(result->m_menus[1]->m_style == 2);
+    }
+
+    TEST_CASE("MenuIncludeFileCache: Cached file included by different menu files uses the defines of each menu file", "[parsing][menu]")
+    {
+        MockSearchPath searchPath;
+        searchPath.AddFileData("ui/menu.inc", INCLUDED_MENU);
+        MenuAssetZoneState zoneState;
+
+        const auto firstResult = ReadMenuFile("first.menu", R"testmenu(
+{
+#define MENU_NAME "First"
+#define MENU_STYLE 1
+#include "ui/menu.inc"
+}
+)testmenu", zoneState, &searchPath);
+
+        const auto secondResult = ReadMenuFile("second.menu", R"testmenu(
+{
+#define MENU_NAME "Second"
+#define MENU_STYLE 2
+#include "ui/menu.inc"
+}
+)testmenu", zoneState, &searchPath);
+
+        REQUIRE(firstResult);
+        REQUIRE(firstResult->m_menus.size() == 1);
+        REQUIRE(firstResult->m_menus[0]->m_name == "First"s);
+        REQUIRE(firstResult->m_menus[0]->m_style == 1);
+
+        REQUIRE(secondResult);
+        REQUIRE(secondResult->m_menus.size() == 1);
+        REQUIRE(secondResult->m_menus[0]->m_name == "Second"s);
+        REQUIRE(secondResult->m_menus[0]->m_style == 2);
+    }
+
+    TEST_CASE("MenuIncludeFileCache: File included by different menu files with the same defines is only preprocessed once", "[parsing][menu]")
+    {
+        MockSearchPath searchPath;
+        searchPath.AddFileData("ui/menu.inc", INCLUDED_MENU);
+        searchPath.AddFileData("ui/defines.inc", R"testmenu(
+#define MENU_NAME "Included"
+#define MENU_STYLE 3
+)testmenu");
+        MenuAssetZoneState zoneState;
+
+        constexpr auto MENU_FILE = R"testmenu(
+{
+#include "ui/defines.inc"
+#include "ui/menu.inc"
+}
+)testmenu";
+
+        auto openedIncludeCount = 0;
+        const auto firstResult = ReadMenuFile("first.menu", MENU_FILE, zoneState, &searchPath, &openedIncludeCount);
+        REQUIRE(openedIncludeCount == 2);
+
+        // Both files are replayed, including the defines of the first one that the second one uses
+        const auto secondResult = ReadMenuFile("second.menu", MENU_FILE, zoneState, &searchPath, &openedIncludeCount);
+        REQUIRE(openedIncludeCount == 2);
+
+        for (const auto* result : {firstResult.get(), secondResult.get()})
+        {
+            REQUIRE(result);
+            REQUIRE(result->m_menus.size() == 1);
+            REQUIRE(result->m_menus[0]->m_name == "Included"s);
+            REQUIRE(result->m_menus[0]->m_style == 3);
+        }
+    }
+
+    TEST_CASE("MenuIncludeFileCache: Remembers files that could not be found", "[parsing][menu]")
+    {
+        MockSearchPath searchPath;
+        MenuIncludeFileCache includeFileCache;
+
+        REQUIRE(includeFileCache.Open("ui/missing.inc", &searchPath) == nullptr);
+
+        // Files are only looked up once, later additions to the search path are not seen by the cache
+        searchPath.AddFileData("ui/missing.inc", INCLUDED_MENU);
+        REQUIRE(includeFileCache.Open("ui/missing.inc", &searchPath) == nullptr);
+    }
+}
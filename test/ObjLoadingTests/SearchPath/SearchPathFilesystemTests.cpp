@@ -0,0 +1,173 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "SearchPath/SearchPathFilesystem.h"
+
+namespace fs = std::filesystem;
+
+namespace test::search_path::filesystem
+{
+    class SearchPathTestDirectory
+    {
+    public:
+        SearchPathTestDirectory()
+            : m_directory(fs::temp_directory_path() / "OatSearchPathFilesystemTests"),
+              m_search_path_directory(m_directory / "root")
+        {
+            std::error_code ec;
+            fs::remove_all(m_directory, ec);
+            fs::create_directories(m_search_path_directory);
+        }
+
+        ~SearchPathTestDirectory()
+        {
+            std::error_code ec;
+            fs::remove_all(m_directory, ec);
+        }
+
+        SearchPathTestDirectory(const SearchPathTestDirectory& other) = delete;
+        SearchPathTestDirectory(SearchPathTestDirectory&& other) noexcept = delete;
+        SearchPathTestDirectory& operator=(const SearchPathTestDirectory& other) = delete;
+        SearchPathTestDirectory& operator=(SearchPathTestDirectory&& other) noexcept = delete;
+
+        void AddFile(const fs::path& relativePath) const
+        {
+            const auto filePath = m_search_path_directory / relativePath;
+            fs::create_directories(filePath.parent_path());
+
+            std::ofstream file(filePath, std::fstream::out | std::fstream::binary);
+            file << relativePath.generic_string();
+        }
+
+        /**
+         * \brief Creates a symlink to a directory inside the search path directory.
+         * \return \c false if the system does not allow creating symlinks.
+         */
+        _NODISCARD bool CreateDirectorySymlink(const fs::path& target, const fs::path& relativeLinkPath) const
+        {
+            std::error_code ec;
+            fs::create_directory_symlink(target, m_search_path_directory / relativeLinkPath, ec);
+            return !ec;
+        }
+
+        _NODISCARD std::unique_ptr<SearchPathFilesystem> CreateSearchPath() const
+        {
+            auto searchPath = std::make_unique<SearchPathFilesystem>(m_search_path_directory.string());
+            searchPath->SetUseFileIndex(true);
+
+            return searchPath;
+        }
+
+        fs::path m_directory;
+        fs::path m_search_path_directory;
+    };
+
+    bool CanOpen(SearchPathFilesystem& searchPath, const std::string& fileName)
+    {
+        return searchPath.Open(fileName).IsOpen();
+    }
+
+    TEST_CASE("SearchPathFilesystem: File index finds existing files and rejects missing ones", "[objloading][searchpath]")
+    {
+        const SearchPathTestDirectory directory;
+        directory.AddFile("test.txt");
+        const auto searchPath = directory.CreateSearchPath();
+
+        REQUIRE(CanOpen(*searchPath, "test.txt"));
+        REQUIRE(!CanOpen(*searchPath, "missing.txt"));
+
+        // The index was built when the first file was opened, so a file added later is not seen
+        directory.AddFile("missing.txt");
+        REQUIRE(!CanOpen(*searchPath, "missing.txt"));
+    }
+
+    TEST_CASE("SearchPathFilesystem: File index normalizes nested paths", "[objloading][searchpath]")
+    {
+        const SearchPathTestDirectory directory;
+        directory.AddFile("test.txt");
+        directory.AddFile("ui/menus/test.menu");
+        const auto searchPath = directory.CreateSearchPath();
+
+        REQUIRE(CanOpen(*searchPath, "ui/menus/test.menu"));
+        REQUIRE(CanOpen(*searchPath, "./ui/menus/test.menu"));
+        REQUIRE(CanOpen(*searchPath, "ui/./menus/test.menu"));
+        REQUIRE(CanOpen(*searchPath, "ui/menus/../menus/test.menu"));
+        REQUIRE(CanOpen(*searchPath, "ui/../test.txt"));
+
+        REQUIRE(!CanOpen(*searchPath, "ui/test.menu"));
+        REQUIRE(!CanOpen(*searchPath, "ui/menus/../test.menu"));
+    }
+
+    TEST_CASE("SearchPathFilesystem: File index does not answer for paths outside of the directory", "[objloading][searchpath]")
+    {
+        const SearchPathTestDirectory directory;
+        directory.AddFile("ui/test.menu");
+        const auto searchPath = directory.CreateSearchPath();
+        REQUIRE(CanOpen(*searchPath, "ui/test.menu"));
+
+        {
+            std::ofstream file(directory.m_directory / "outside.txt", std::fstream::out | std::fstream::binary);
+            file << "outside";
+        }
+
+        REQUIRE(CanOpen(*searchPath, "../outside.txt"));
+        REQUIRE(CanOpen(*searchPath, "ui/../../outside.txt"));
+    }
+
+    TEST_CASE("SearchPathFilesystem: File index can be built for directories with symlink cycles", "[objloading][searchpath]")
+    {
+        const SearchPathTestDirectory directory;
+        directory.AddFile("test.txt");
+        directory.AddFile("ui/test.menu");
+        if (!directory.CreateDirectorySymlink(directory.m_search_path_directory, "ui/cycle"))
+            return;
+
+        const auto searchPath = directory.CreateSearchPath();
+
+        REQUIRE(CanOpen(*searchPath, "test.txt"));
+        REQUIRE(CanOpen(*searchPath, "ui/test.menu"));
+        REQUIRE(!CanOpen(*searchPath, "ui/missing.menu"));
+
+        // Files reached through the cycle are not in the index but can still be opened
+        REQUIRE(CanOpen(*searchPath, "ui/cycle/test.txt"));
+        REQUIRE(CanOpen(*searchPath, "ui/cycle/ui/cycle/ui/test.menu"));
+    }
+
+    TEST_CASE("SearchPathFilesystem: Files under a symlink to an already indexed directory can be opened", "[objloading][searchpath]")
+    {
+        const SearchPathTestDirectory directory;
+        directory.AddFile("ui/test.menu");
+        if (!directory.CreateDirectorySymlink(directory.m_search_path_directory / "ui", "linked"))
+            return;
+
+        const auto searchPath = directory.CreateSearchPath();
+
+        // Only one of the two paths to the directory is indexed, which one depends on the order they are listed in
+        REQUIRE(CanOpen(*searchPath, "ui/test.menu"));
+        REQUIRE(CanOpen(*searchPath, "linked/test.menu"));
+        REQUIRE(!CanOpen(*searchPath, "missing/test.menu"));
+
+        // Whichever path was not indexed is looked up on the filesystem
+        directory.AddFile("ui/added.menu");
+        REQUIRE(CanOpen(*searchPath, "ui/added.menu") != CanOpen(*searchPath, "linked/added.menu"));
+    }
+
+    TEST_CASE("SearchPathFilesystem: Invalidating the file index finds files that were added later", "[objloading][searchpath]")
+    {
+        const SearchPathTestDirectory directory;
+        directory.AddFile("test.txt");
+        const auto searchPath = directory.CreateSearchPath();
+
+        REQUIRE(CanOpen(*searchPath, "test.txt"));
+
+        directory.AddFile("ui/added.menu");
+        REQUIRE(!CanOpen(*searchPath, "ui/added.menu"));
+
+        searchPath->InvalidateFileIndex();
+        REQUIRE(CanOpen(*searchPath, "ui/added.menu"));
+        REQUIRE(CanOpen(*searchPath, "test.txt"));
+    }
+}
@@ -0,0 +1,180 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <sstream>
+
+#include "StateMap/StateMapHandler.h"
+#include "StateMap/StateMapReader.h"
+
+using namespace state_map;
+
+namespace test::state_map::handler
+{
+    constexpr auto STATE_BITS_COUNT = 2u;
+
+    const StateMapLayoutVars TEST_VARS({
+        StateMapLayoutVar("mtlBlendOp", 0, {
+                              StateMapLayoutVarValue("Add", 0x1),
+                              StateMapLayoutVarValue("Subtract", 0x2),
+                              StateMapLayoutVarValue("Disable", 0x4),
+                          }),
+        StateMapLayoutVar("mtlSrcBlend", 0, {
+                              StateMapLayoutVarValue("One", 0x10),
+                              StateMapLayoutVarValue("Zero", 0x20),
+                              StateMapLayoutVarValue("SrcAlpha", 0x40),
+                          }),
+        StateMapLayoutVar("mtlColorWrite", 0, {
+                              StateMapLayoutVarValue("Enable", 0x100),
+                              StateMapLayoutVarValue("Disable", 0x200),
+                          }),
+        StateMapLayoutVar("mtlPolygonOffset", 1, {
+                              StateMapLayoutVarValue("0", 0x1),
+                              StateMapLayoutVarValue("1", 0x2),
+                              StateMapLayoutVarValue("2", 0x4),
+                          }),
+        StateMapLayoutVar("mtlDepthWrite", 1, {
+                              StateMapLayoutVarValue("On", 0x10),
+                              StateMapLayoutVarValue("Off", 0x20),
+                          }),
+    });
+
+    const StateMapLayoutEntries TEST_ENTRIES({
+        StateMapLayoutEntry("blend", 0, 0x77, {"mtlBlendOp", "mtlSrcBlend"}),
+        StateMapLayoutEntry("depthWrite", 1, 0x30, {"mtlDepthWrite"}),
+        StateMapLayoutEntry("colorWrite", 0, 0x300, {"mtlColorWrite"}),
+    });
+
+    const StateMapLayout TEST_LAYOUT(STATE_BITS_COUNT, TEST_ENTRIES, TEST_VARS);
+
+    constexpr auto TEST_STATE_MAP = R"sm(
+blend
+{
+    mtlBlendOp == Disable:
+        Disable, One;
+    mtlBlendOp == Add && mtlSrcBlend == SrcAlpha:
+    mtlPolygonOffset == 2:
+        Add, SrcAlpha;
+    default:
+        passthrough;
+}
+
+depthWrite
+{
+    mtlBlendOp == Disable || mtlPolygonOffset != 0:
+        On;
+    !(mtlSrcBlend == Zero) && mtlColorWrite == Enable:
+        Off;
+    default:
+        passthrough;
+}
+
+colorWrite
+{
+    mtlDepthWrite == On && (mtlBlendOp == Subtract || mtlSrcBlend == One):
+        Disable;
+    default:
+        Enable;
+}
+)sm";
+
+    std::unique_ptr<StateMapDefinition> ReadTestStateMap()
+    {
+        std::istringstream ss(TEST_STATE_MAP);
+        const StateMapReader reader(ss, "test.sm", "test", TEST_LAYOUT);
+
+        return reader.ReadStateMapDefinition();
+    }
+
+    /**
+     * \brief Applies a state map by evaluating every condition on the vars of the base state bits.
+     */
+    void ApplyStateMapByEvaluation(const StateMapDefinition& stateMap, const uint32_t* baseStateBits, uint32_t* outStateBits)
+    {
+        StateMapVars vars;
+        for (const auto& var : TEST_LAYOUT.m_var_layout.m_vars)
+        {
+            const auto baseStateBitField = baseStateBits[var.m_state_bits_index];
+            const auto matchingValue = std::find_if(var.m_values.begin(), var.m_values.end(), [&baseStateBitField](const StateMapLayoutVarValue& value)
+            {
+                return (baseStateBitField & value.m_state_bits_mask) == value.m_state_bits_mask;
+            });
+
+            if (matchingValue != var.m_values.end())
+                vars.AddValue(var.m_name, matchingValue->m_name);
+        }
+
+        for (auto i = 0u; i < STATE_BITS_COUNT; i++)
+            outStateBits[i] = baseStateBits[i];
+
+        for (auto entryIndex = 0u; entryIndex < stateMap.m_state_map_entries.size(); entryIndex++)
+        {
+            const auto& entry = stateMap.m_state_map_entries[entryIndex];
+            const auto matchingRule = std::find_if(entry.m_rules.begin(), entry.m_rules.end(), [&vars](const std::unique_ptr<StateMapRule>& rule)
+            {
+                return std::any_of(rule->m_conditions.begin(), rule->m_conditions.end(), [&vars](const std::unique_ptr<ISimpleExpression>& condition)
+                {
+                    return condition->EvaluateNonStatic(&vars).IsTruthy();
+                });
+            });
+
+            const auto& rule = matchingRule != entry.m_rules.end() ? **matchingRule : *entry.m_rules[entry.m_default_index];
+            if (rule.m_passthrough)
+                continue;
+
+            const auto& layoutEntry = TEST_LAYOUT.m_entry_layout.m_entries[entryIndex];
+            outStateBits[layoutEntry.m_state_bits_index] &= ~layoutEntry.m_state_bits_mask;
+            outStateBits[layoutEntry.m_state_bits_index] |= rule.m_value;
+        }
+    }
+
+    TEST_CASE("StateMapHandler: Compiled state map gives the same results as evaluating its conditions", "[statemap]")
+    {
+        const auto stateMap = ReadTestStateMap();
+        REQUIRE(stateMap);
+
+        const StateMapHandler handler(TEST_LAYOUT, *stateMap);
+        const auto& vars = TEST_LAYOUT.m_var_layout.m_vars;
+
+        // Go through every combination of var values, the last value index of each var stands for no matching value
+        std::vector<size_t> valueIndices(vars.size(), 0u);
+        auto combinationCount = 0u;
+        while (true)
+        {
+            uint32_t baseStateBits[STATE_BITS_COUNT]{};
+            for (auto varIndex = 0u; varIndex < vars.size(); varIndex++)
+            {
+                const auto& var = vars[varIndex];
+                if (valueIndices[varIndex] < var.m_values.size())
+                    baseStateBits[var.m_state_bits_index] |= var.m_values[valueIndices[varIndex]].m_state_bits_mask;
+            }
+
+            // Bits that are not part of the layout have to stay untouched
+            baseStateBits[1] |= 0x80000000u;
+
+            uint32_t expectedStateBits[STATE_BITS_COUNT];
+            ApplyStateMapByEvaluation(*stateMap, baseStateBits, expectedStateBits);
+
+            uint32_t actualStateBits[STATE_BITS_COUNT];
+            handler.ApplyStateMap(baseStateBits, actualStateBits);
+            REQUIRE(actualStateBits[0] == expectedStateBits[0]);
+            REQUIRE(actualStateBits[1] == expectedStateBits[1]);
+
+            // The second time the result is taken from the cache of the handler
+            uint32_t cachedStateBits[STATE_BITS_COUNT];
+            handler.ApplyStateMap(baseStateBits, cachedStateBits);
+            REQUIRE(cachedStateBits[0] == expectedStateBits[0]);
+            REQUIRE(cachedStateBits[1] == expectedStateBits[1]);
+
+            combinationCount++;
+
+            auto varIndex = 0u;
+            while (varIndex < vars.size() && ++valueIndices[varIndex] > vars[varIndex].m_values.size())
+                valueIndices[varIndex++] = 0u;
+
+            if (varIndex >= vars.size())
+                break;
+        }
+
+        REQUIRE(combinationCount == 4u * 4u * 3u * 4u * 3u);
+    }
+}
@@ -0,0 +1,291 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Model/XModel/XModelExportWriter.h"
+
+namespace test::model::xmodel::xmodel_export
+{
+    class TestSurfaceVertex
+    {
+    public:
+        float m_x;
+        float m_y;
+        float m_u;
+        float m_v;
+    };
+
+    class TestSurface
+    {
+    public:
+        std::vector<TestSurfaceVertex> m_vertices;
+        std::vector<XModelFace> m_faces;
+    };
+
+    /**
+     * \brief A lod of two quads next to each other, one per surface and material. The surfaces share the positions of the edge between them.
+     */
+    class TestSurfaceSource final : public IXModelSurfaceSource
+    {
+        std::vector<TestSurface> m_surfaces;
+
+        static XModelFace CreateFace(const int v0, const int v1, const int v2, const int surfaceIndex)
+        {
+            return XModelFace{
+                {v0, v1, v2},
+                surfaceIndex,
+                surfaceIndex
+            };
+        }
+
+    public:
+        TestSurfaceSource()
+        {
+            m_surfaces.emplace_back(TestSurface{
+                {{0, 0, 0.0f, 0.0f}, {1, 0, 0.5f, 0.0f}, {1, 1, 0.5f, 1.0f}, {0, 1, 0.0f, 1.0f}},
+                {CreateFace(0, 1, 2, 0), CreateFace(0, 2, 3, 0)}
+            });
+
+            // The last vertex has the same position as the second one but a different uv
+            m_surfaces.emplace_back(TestSurface{
+                {{1, 0, 0.5f, 0.0f}, {2, 0, 1.0f, 0.0f}, {2, 1, 1.0f, 1.0f}, {1, 1, 0.5f, 1.0f}, {2, 0, 0.9f, 0.1f}},
+                {CreateFace(0, 1, 2, 1), CreateFace(0, 2, 3, 1), CreateFace(4, 2, 0, 1)}
+            });
+        }
+
+        _NODISCARD size_t GetSurfaceCount() const override
+        {
+            return m_surfaces.size();
+        }
+
+        _NODISCARD size_t GetSurfaceVertexCount(const size_t surfaceIndex) const override
+        {
+            return m_surfaces[surfaceIndex].m_vertices.size();
+        }
+
+        _NODISCARD size_t GetSurfaceFaceCount(const size_t surfaceIndex) const override
+        {
+            return m_surfaces[surfaceIndex].m_faces.size();
+        }
+
+        void ReadSurfaceVertices(const size_t surfaceIndex, std::vector<XModelVertex>& vertices) const override
+        {
+            for (const auto& vertex : m_surfaces[surfaceIndex].m_vertices)
+            {
+                vertices.emplace_back(XModelVertex{
+                    {vertex.m_x, vertex.m_y, 0.0f},
+                    {0.0f, 0.0f, 1.0f},
+                    {1.0f, 1.0f, 1.0f, 1.0f},
+                    {vertex.m_u, vertex.m_v}
+                });
+            }
+        }
+
+        void ReadSurfaceVertexBoneWeights(const size_t surfaceIndex, std::vector<XModelVertexBoneWeights>& vertexBoneWeights) const override
+        {
+            for (const auto& vertex : m_surfaces[surfaceIndex].m_vertices)
+            {
+                XModelVertexBoneWeights weights{};
+                weights.weights[0] = XModelBoneWeight{vertex.m_x > 1.5f ? 1 : 0, 1.0f};
+                weights.weightCount = 1u;
+                vertexBoneWeights.emplace_back(weights);
+            }
+        }
+
+        void ReadSurfaceFaces(const size_t surfaceIndex, std::vector<XModelFace>& faces) const override
+        {
+            faces.insert(faces.end(), m_surfaces[surfaceIndex].m_faces.begin(), m_surfaces[surfaceIndex].m_faces.end());
+        }
+    };
+
+    void AddMaterial(XModelExportWriter& writer, std::string name, std::string colorMapName)
+    {
+        XModelMaterial material{};
+        material.ApplyDefaults();
+        material.name = std::move(name);
+        material.colorMapName = std::move(colorMapName);
+        writer.AddMaterial(std::move(material));
+    }
+
+    TEST_CASE("XModelExportWriter: Merges vertices of all surfaces of a lod", "[model][xmodel]")
+    {
+        const TestSurfaceSource surfaceSource;
+        const auto writer = XModelExportWriter::CreateWriterForVersion6("T6", "test_zone");
+
+        writer->AddBone(XModelBone{"tag_origin", -1, {1, 1, 1}, {0, 0, 0}, {0, 0, 0}, Quaternion32(0, 0, 0, 1), Quaternion32(0, 0, 0, 1)});
+        writer->AddBone(XModelBone{"j_child", 0, {1, 1, 1}, {1, 0, 0}, {1, 0, 0}, Quaternion32(0, 0, 0, 1), Quaternion32(0, 0, 0, 1)});
+        writer->AddObject(XModelObject{"surf0"});
+        writer->AddObject(XModelObject{"surf1"});
+        AddMaterial(*writer, "mtl_a", "img_a");
+        AddMaterial(*writer, "mtl_b", "img_b");
+        writer->SetSurfaceSource(&surfaceSource);
+
+        std::ostringstream ss;
+        writer->Write(ss);
+
+        // The output of the writer that held all vertices of the lod in memory at once
+        const std::string expected = "// OpenAssetTools XMODEL_EXPORT File\n"
+                                     "// Game Origin: T6\n"
+                                     "// Zone Origin: test_zone\n"
+                                     "MODEL\n"
+                                     "VERSION 6\n"
+                                     "\n"
+                                     "NUMBONES 2\n"
+                                     "BONE 0 -1 \"tag_origin\"\n"
+                                     "BONE 1 0 \"j_child\"\n"
+                                     "\n"
+                                     "BONE 0\n"
+                                     "OFFSET 0.000000, 0.000000, 0.000000\n"
+                                     "SCALE 1.000000, 1.000000, 1.000000\n"
+                                     "X 1.000000, 0.000000, 0.000000\n"
+                                     "Y 0.000000, 1.000000, 0.000000\n"
+                                     "Z 0.000000, 0.000000, 1.000000\n"
+                                     "\n"
+                                     "BONE 1\n"
+                                     "OFFSET 1.000000, 0.000000, 0.000000\n"
+                                     "SCALE 1.000000, 1.000000, 1.000000\n"
+                                     "X 1.000000, 0.000000, 0.000000\n"
+                                     "Y 0.000000, 1.000000, 0.000000\n"
+                                     "Z 0.000000, 0.000000, 1.000000\n"
+                                     "\n"
+                                     "NUMVERTS 6\n"
+                                     "VERT 0\n"
+                                     "OFFSET 0.000000, 0.000000, 0.000000\n"
+                                     "BONES 1\n"
+                                     "BONE 0 1.000000\n"
+                                     "\n"
+                                     "VERT 1\n"
+                                     "OFFSET 1.000000, 0.000000, 0.000000\n"
+                                     "BONES 1\n"
+                                     "BONE 0 1.000000\n"
+                                     "\n"
+                                     "VERT 2\n"
+                                     "OFFSET 1.000000, 1.000000, 0.000000\n"
+                                     "BONES 1\n"
+                                     "BONE 0 1.000000\n"
+                                     "\n"
+                                     "VERT 3\n"
+                                     "OFFSET 0.000000, 1.000000, 0.000000\n"
+                                     "BONES 1\n"
+                                     "BONE 0 1.000000\n"
+                                     "\n"
+                                     "VERT 4\n"
+                                     "OFFSET 2.000000, 0.000000, 0.000000\n"
+                                     "BONES 1\n"
+                                     "BONE 1 1.000000\n"
+                                     "\n"
+                                     "VERT 5\n"
+                                     "OFFSET 2.000000, 1.000000, 0.000000\n"
+                                     "BONES 1\n"
+                                     "BONE 1 1.000000\n"
+                                     "\n"
+                                     "NUMFACES 5\n"
+                                     "TRI 0 0 0 0\n"
+                                     "VERT 0\n"
+                                     "NORMAL 0.000000 0.000000 1.000000\n"
+                                     "COLOR 1.000000 1.000000 1.000000 1.000000\n"
+                                     "UV 1 0.000000 0.000000\n"
+                                     "VERT 1\n"
+                                     "NORMAL 0.000000 0.000000 1.000000\n"
+                                     "COLOR 1.000000 1.000000 1.000000 1.000000\n"
+                                     "UV 1 0.500000 0.000000\n"
+                                     "VERT 2\n"
+                                     "NORMAL 0.000000 0.000000 1.000000\n"
+                                     "COLOR 1.000000 1.000000 1.000000 1.000000\n"
+                                     "UV 1 0.500000 1.000000\n"
+                                     "\n"
+                                     "TRI 0 0 0 0\n"
+                                     "VERT 0\n"
+                                     "NORMAL 0.000000 0.000000 1.000000\n"
+                                     "COLOR 1.000000 1.000000 1.000000 1.000000\n"
+                                     "UV 1 0.000000 0.000000\n"
+                                     "VERT 2\n"
+                                     "NORMAL 0.000000 0.000000 1.000000\n"
+                                     "COLOR 1.000000 1.000000 1.000000 1.000000\n"
+                                     "UV 1 0.500000 1.000000\n"
+                                     "VERT 3\n"
+                                     "NORMAL 0.000000 0.000000 1.000000\n"
+                                     "COLOR 1.000000 1.000000 1.000000 1.000000\n"
+                                     "UV 1 0.000000 1.000000\n"
+                                     "\n"
+                                     "TRI 1 1 0 0\n"
+                                     "VERT 1\n"
+                                     "NORMAL 0.000000 0.000000 1.000000\n"
+                                     "COLOR 1.000000 1.000000 1.000000 1.000000\n"
+                                     "UV 1 0.500000 0.000000\n"
+                                     "VERT 4\n"
+                                     "NORMAL 0.000000 0.000000 1.000000\n"
+                                     "COLOR 1.000000 1.000000 1.000000 1.000000\n"
+                                     "UV 1 1.000000 0.000000\n"
+                                     "VERT 5\n"
+                                     "NORMAL 0.000000 0.000000 1.000000\n"
+                                     "COLOR 1.000000 1.000000 1.000000 1.000000\n"
+                                     "UV 1 1.000000 1.000000\n"
+                                     "\n"
+                                     "TRI 1 1 0 0\n"
+                                     "VERT 1\n"
+                                     "NORMAL 0.000000 0.000000 1.000000\n"
+                                     "COLOR 1.000000 1.000000 1.000000 1.000000\n"
+                                     "UV 1 0.500000 0.000000\n"
+                                     "VERT 5\n"
+                                     "NORMAL 0.000000 0.000000 1.000000\n"
+                                     "COLOR 1.000000 1.000000 1.000000 1.000000\n"
+                                     "UV 1 1.000000 1.000000\n"
+                                     "VERT 2\n"
+                                     "NORMAL 0.000000 0.000000 1.000000\n"
+                                     "COLOR 1.000000 1.000000 1.000000 1.000000\n"
+                                     "UV 1 0.500000 1.000000\n"
+                                     "\n"
+                                     "TRI 1 1 0 0\n"
+                                     "VERT 4\n"
+                                     "NORMAL 0.000000 0.000000 1.000000\n"
+                                     "COLOR 1.000000 1.000000 1.000000 1.000000\n"
+                                     "UV 1 0.900000 0.100000\n"
+                                     "VERT 5\n"
+                                     "NORMAL 0.000000 0.000000 1.000000\n"
+                                     "COLOR 1.000000 1.000000 1.000000 1.000000\n"
+                                     "UV 1 1.000000 1.000000\n"
+                                     "VERT 1\n"
+                                     "NORMAL 0.000000 0.000000 1.000000\n"
+                                     "COLOR 1.000000 1.000000 1.000000 1.000000\n"
+                                     "UV 1 0.500000 0.000000\n"
+                                     "\n"
+                                     "NUMOBJECTS 2\n"
+                                     "OBJECT 0 \"surf0\"\n"
+                                     "OBJECT 1 \"surf1\"\n"
+                                     "\n"
+                                     "NUMMATERIALS 2\n"
+                                     "MATERIAL 0 \"mtl_a\" \"Phong\" \"../images/img_a.dds\"\n"
+                                     "COLOR 0.000000 0.000000 0.000000 1.000000\n"
+                                     "TRANSPARENCY 0.000000 0.000000 0.000000 1.000000\n"
+                                     "AMBIENTCOLOR 0.000000 0.000000 0.000000 1.000000\n"
+                                     "INCANDESCENCE 0.000000 0.000000 0.000000 1.000000\n"
+                                     "COEFFS 0.800000 0.000000\n"
+                                     "GLOW 0.000000 0\n"
+                                     "REFRACTIVE 6 1.000000\n"
+                                     "SPECULARCOLOR -1.000000 -1.000000 -1.000000 1.000000\n"
+                                     "REFLECTIVECOLOR -1.000000 -1.000000 -1.000000 1.000000\n"
+                                     "REFLECTIVE -1 -1.000000\n"
+                                     "BLINN -1.000000 -1.000000\n"
+                                     "PHONG -1.000000\n"
+                                     "\n"
+                                     "MATERIAL 1 \"mtl_b\" \"Phong\" \"../images/img_b.dds\"\n"
+                                     "COLOR 0.000000 0.000000 0.000000 1.000000\n"
+                                     "TRANSPARENCY 0.000000 0.000000 0.000000 1.000000\n"
+                                     "AMBIENTCOLOR 0.000000 0.000000 0.000000 1.000000\n"
+                                     "INCANDESCENCE 0.000000 0.000000 0.000000 1.000000\n"
+                                     "COEFFS 0.800000 0.000000\n"
+                                     "GLOW 0.000000 0\n"
+                                     "REFRACTIVE 6 1.000000\n"
+                                     "SPECULARCOLOR -1.000000 -1.000000 -1.000000 1.000000\n"
+                                     "REFLECTIVECOLOR -1.000000 -1.000000 -1.000000 1.000000\n"
+                                     "REFLECTIVE -1 -1.000000\n"
+                                     "BLINN -1.000000 -1.000000\n"
+                                     "PHONG -1.000000\n"
+                                     "\n";
+
+        REQUIRE(ss.str() == expected);
+    }
+}
@@ -741,4 +741,27 @@ namespace test::parsing::impl::defines_stream_proxy
 
         REQUIRE(proxy.Eof());
     }
+
+    TEST_CASE("DefinesStreamProxy: Ensure self referencing defines are not expanded again", "[parsing][parsingstream]")
+    {
+        const std::vector<std::string> lines
+        {
+            "#define foo foo bar",
+            "#define a b",
+            "#define b a",
+            "foo",
+            "a b"
+        };
+
+        MockParserLineStream mockStream(lines);
+        DefinesStreamProxy proxy(&mockStream);
+
+        ExpectLine(&proxy, 1, "");
+        ExpectLine(&proxy, 2, "");
+        ExpectLine(&proxy, 3, "");
+        ExpectLine(&proxy, 4, "foo bar");
+        ExpectLine(&proxy, 5, "a b");
+
+        REQUIRE(proxy.Eof());
+    }
 }
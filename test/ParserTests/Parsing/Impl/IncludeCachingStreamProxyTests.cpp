@@ -0,0 +1,298 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <map>
+
+#include "Parsing/Impl/DefinesStreamProxy.h"
+#include "Parsing/Impl/IncludeCachingStreamProxy.h"
+#include "Parsing/Impl/IncludingStreamProxy.h"
+#include "Parsing/Impl/PreprocessedIncludeCache.h"
+#include "Parsing/Mock/MockParserLineStream.h"
+
+namespace test::parsing::impl::include_caching_stream_proxy
+{
+    /**
+     * \brief The proxies the same way they are set up for reading menu files.
+     */
+    class IncludeCachingTestStream
+    {
+    public:
+        MockParserLineStream m_mock_stream;
+        IncludeCachingStreamProxy m_include_caching_proxy;
+        IncludingStreamProxy m_including_proxy;
+        DefinesStreamProxy m_defines_proxy;
+
+        IncludeCachingTestStream(const std::vector<std::string>& lines, const std::map<std::string, std::vector<std::string>>& includes, PreprocessedIncludeCache& cache)
+            : m_mock_stream(lines),
+              m_include_caching_proxy(&m_mock_stream, &cache),
+              m_including_proxy(&m_include_caching_proxy),
+              m_defines_proxy(&m_including_proxy)
+        {
+            for (const auto& [filename, includeLines] : includes)
+                m_mock_stream.AddIncludeLines(filename, includeLines);
+
+            m_include_caching_proxy.SetDefinesProxy(&m_defines_proxy);
+        }
+    };
+
+    void ExpectLine(IParserLineStream* stream, const std::string& filename, const int lineNumber, const std::string& value)
+    {
+        auto line = stream->NextLine();
+        REQUIRE(*line.m_filename == filename);
+        REQUIRE(line.m_line_number == lineNumber);
+        REQUIRE(line.m_line == value);
+    }
+
+    void ExpectEof(IParserLineStream* stream)
+    {
+        // Included files are only cached once the line after them was read
+        REQUIRE(stream->NextLine().IsEof());
+        REQUIRE(stream->Eof());
+    }
+
+    TEST_CASE("IncludeCachingStreamProxy: File included with the same defines is replayed", "[parsing][parsingstream]")
+    {
+        const std::vector<std::string> lines
+        {
+            "#include \"ASDF.txt\"",
+            "and bye"
+        };
+
+        PreprocessedIncludeCache cache;
+
+        {
+            IncludeCachingTestStream stream(lines, {{"ASDF.txt", {"Hello galaxy"}}}, cache);
+
+            ExpectLine(&stream.m_defines_proxy, "ASDF.txt", 1, "Hello galaxy");
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 2, "and bye");
+            ExpectEof(&stream.m_defines_proxy);
+        }
+
+        {
+            // The file is not read again, otherwise the changed contents would be seen
+            IncludeCachingTestStream stream(lines, {{"ASDF.txt", {"Hello universe"}}}, cache);
+
+            ExpectLine(&stream.m_defines_proxy, "ASDF.txt", 1, "Hello galaxy");
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 2, "and bye");
+            ExpectEof(&stream.m_defines_proxy);
+        }
+    }
+
+    TEST_CASE("IncludeCachingStreamProxy: File included with different defines is preprocessed again", "[parsing][parsingstream]")
+    {
+        const std::vector<std::string> includeLines
+        {
+            "Hello NAME"
+        };
+
+        const std::vector<std::string> firstLines
+        {
+            "#define NAME galaxy",
+            "#include \"ASDF.txt\""
+        };
+
+        const std::vector<std::string> secondLines
+        {
+            "#define NAME universe",
+            "#include \"ASDF.txt\""
+        };
+
+        PreprocessedIncludeCache cache;
+
+        {
+            IncludeCachingTestStream stream(firstLines, {{"ASDF.txt", includeLines}}, cache);
+
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 1, "");
+            ExpectLine(&stream.m_defines_proxy, "ASDF.txt", 1, "Hello galaxy");
+            ExpectEof(&stream.m_defines_proxy);
+        }
+
+        {
+            IncludeCachingTestStream stream(secondLines, {{"ASDF.txt", includeLines}}, cache);
+
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 1, "");
+            ExpectLine(&stream.m_defines_proxy, "ASDF.txt", 1, "Hello universe");
+            ExpectEof(&stream.m_defines_proxy);
+        }
+    }
+
+    TEST_CASE("IncludeCachingStreamProxy: Define changes of a replayed file are applied", "[parsing][parsingstream]")
+    {
+        const std::vector<std::string> lines
+        {
+            "#define REMOVED 1",
+            "#include \"ASDF.txt\"",
+            "Hello NAME",
+            "#ifdef REMOVED",
+            "Removed was not undefined",
+            "#endif"
+        };
+
+        const std::vector<std::string> includeLines
+        {
+            "#define NAME galaxy",
+            "#undef REMOVED"
+        };
+
+        PreprocessedIncludeCache cache;
+
+        for (auto run = 0; run < 2; run++)
+        {
+            // The second time the file is replayed, it must not be read again
+            IncludeCachingTestStream stream(lines, {{"ASDF.txt", run == 0 ? includeLines : std::vector<std::string>()}}, cache);
+
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 1, "");
+            ExpectLine(&stream.m_defines_proxy, "ASDF.txt", 1, "");
+            ExpectLine(&stream.m_defines_proxy, "ASDF.txt", 2, "");
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 3, "Hello galaxy");
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 4, "");
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 5, "");
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 6, "");
+            ExpectEof(&stream.m_defines_proxy);
+        }
+    }
+
+    TEST_CASE("IncludeCachingStreamProxy: Nested file included on the last line is replayed with the file including it", "[parsing][parsingstream]")
+    {
+        const std::vector<std::string> lines
+        {
+            "#include \"Outer.txt\"",
+            "and bye"
+        };
+
+        const std::vector<std::string> outerLines
+        {
+            "Hello outer",
+            "#include \"Inner.txt\""
+        };
+
+        const std::vector<std::string> innerLines
+        {
+            "Hello inner"
+        };
+
+        PreprocessedIncludeCache cache;
+
+        for (auto run = 0; run < 2; run++)
+        {
+            std::map<std::string, std::vector<std::string>> includes;
+            if (run == 0)
+                includes = {{"Outer.txt", outerLines}, {"Inner.txt", innerLines}};
+
+            IncludeCachingTestStream stream(lines, includes, cache);
+
+            ExpectLine(&stream.m_defines_proxy, "Outer.txt", 1, "Hello outer");
+            ExpectLine(&stream.m_defines_proxy, "Inner.txt", 1, "Hello inner");
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 2, "and bye");
+            ExpectEof(&stream.m_defines_proxy);
+        }
+
+        // The nested file was cached on its own as well
+        const std::vector<std::string> innerOnlyLines
+        {
+            "#include \"Inner.txt\""
+        };
+
+        IncludeCachingTestStream stream(innerOnlyLines, {}, cache);
+        ExpectLine(&stream.m_defines_proxy, "Inner.txt", 1, "Hello inner");
+        ExpectEof(&stream.m_defines_proxy);
+    }
+
+    TEST_CASE("IncludeCachingStreamProxy: File recorded after a replayed file only contains its own lines", "[parsing][parsingstream]")
+    {
+        const std::vector<std::string> firstLines
+        {
+            "#include \"First.txt\""
+        };
+
+        const std::vector<std::string> bothLines
+        {
+            "#include \"First.txt\"",
+            "#include \"Second.txt\""
+        };
+
+        const std::vector<std::string> secondLines
+        {
+            "#include \"Second.txt\""
+        };
+
+        PreprocessedIncludeCache cache;
+
+        {
+            IncludeCachingTestStream stream(firstLines, {{"First.txt", {"Hello first"}}}, cache);
+            ExpectLine(&stream.m_defines_proxy, "First.txt", 1, "Hello first");
+            ExpectEof(&stream.m_defines_proxy);
+        }
+
+        {
+            // The first file is replayed, the second one is recorded before the lines of the first one were returned
+            IncludeCachingTestStream stream(bothLines, {{"Second.txt", {"Hello second"}}}, cache);
+            ExpectLine(&stream.m_defines_proxy, "First.txt", 1, "Hello first");
+            ExpectLine(&stream.m_defines_proxy, "Second.txt", 1, "Hello second");
+            ExpectEof(&stream.m_defines_proxy);
+        }
+
+        {
+            IncludeCachingTestStream stream(secondLines, {}, cache);
+            ExpectLine(&stream.m_defines_proxy, "Second.txt", 1, "Hello second");
+            ExpectEof(&stream.m_defines_proxy);
+        }
+    }
+
+    TEST_CASE("IncludeCachingStreamProxy: Files using pragmas are not cached", "[parsing][parsingstream]")
+    {
+        const std::vector<std::string> lines
+        {
+            "#include \"ASDF.txt\""
+        };
+
+        PreprocessedIncludeCache cache;
+
+        {
+            IncludeCachingTestStream stream(lines, {{"ASDF.txt", {"#pragma once", "Hello galaxy"}}}, cache);
+            ExpectLine(&stream.m_defines_proxy, "ASDF.txt", 2, "Hello galaxy");
+            ExpectEof(&stream.m_defines_proxy);
+        }
+
+        {
+            IncludeCachingTestStream stream(lines, {{"ASDF.txt", {"#pragma once", "Hello universe"}}}, cache);
+            ExpectLine(&stream.m_defines_proxy, "ASDF.txt", 2, "Hello universe");
+            ExpectEof(&stream.m_defines_proxy);
+        }
+    }
+
+    TEST_CASE("IncludeCachingStreamProxy: Files changing blocks they did not open are not cached", "[parsing][parsingstream]")
+    {
+        const std::vector<std::string> lines
+        {
+            "#ifdef UNDEFINED",
+            "#else",
+            "#include \"ASDF.txt\"",
+            "Hidden",
+            "#endif"
+        };
+
+        PreprocessedIncludeCache cache;
+
+        {
+            IncludeCachingTestStream stream(lines, {{"ASDF.txt", {"Hello galaxy", "#else"}}}, cache);
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 1, "");
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 2, "");
+            ExpectLine(&stream.m_defines_proxy, "ASDF.txt", 1, "Hello galaxy");
+            ExpectLine(&stream.m_defines_proxy, "ASDF.txt", 2, "");
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 4, "");
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 5, "");
+            ExpectEof(&stream.m_defines_proxy);
+        }
+
+        {
+            IncludeCachingTestStream stream(lines, {{"ASDF.txt", {"Hello universe", "#else"}}}, cache);
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 1, "");
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 2, "");
+            ExpectLine(&stream.m_defines_proxy, "ASDF.txt", 1, "Hello universe");
+            ExpectLine(&stream.m_defines_proxy, "ASDF.txt", 2, "");
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 4, "");
+            ExpectLine(&stream.m_defines_proxy, MockParserLineStream::MOCK_FILENAME, 5, "");
+            ExpectEof(&stream.m_defines_proxy);
+        }
+    }
+}
@@ -0,0 +1,67 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <sstream>
+
+#include "Parsing/Impl/ParserSingleInputStream.h"
+
+namespace test::parsing::impl::parser_single_input_stream
+{
+    TEST_CASE("ParserSingleInputStream: Ensure lines are split on all line terminators", "[parsing][parsingstream]")
+    {
+        std::istringstream input("hello\r\nwor\rld\n\nlast");
+        ParserSingleInputStream stream(input, "test");
+
+        {
+            auto line = stream.NextLine();
+            REQUIRE(line.m_line_number == 1);
+            REQUIRE(line.m_line == "hello");
+        }
+
+        {
+            auto line = stream.NextLine();
+            REQUIRE(line.m_line_number == 2);
+            REQUIRE(line.m_line == "wor\rld");
+        }
+
+        {
+            auto line = stream.NextLine();
+            REQUIRE(line.m_line_number == 3);
+            REQUIRE(line.m_line.empty());
+        }
+
+        REQUIRE(!stream.Eof());
+
+        {
+            auto line = stream.NextLine();
+            REQUIRE(line.m_line_number == 4);
+            REQUIRE(line.m_line == "last");
+        }
+
+        REQUIRE(stream.Eof());
+        REQUIRE(stream.NextLine().IsEof());
+    }
+
+    TEST_CASE("ParserSingleInputStream: Ensure eof is only reached after reading past a trailing line terminator", "[parsing][parsingstream]")
+    {
+        std::istringstream input("first\nsecond\n");
+        ParserSingleInputStream stream(input, "test");
+
+        REQUIRE(stream.NextLine().m_line == "first");
+        REQUIRE(stream.NextLine().m_line == "second");
+        REQUIRE(!stream.Eof());
+
+        REQUIRE(stream.NextLine().IsEof());
+        REQUIRE(stream.Eof());
+    }
+
+    TEST_CASE("ParserSingleInputStream: Ensure lines longer than the read buffer are returned whole", "[parsing][parsingstream]")
+    {
+        const std::string longLine(200000, 'a');
+        std::istringstream input(longLine + "\nb");
+        ParserSingleInputStream stream(input, "test");
+
+        REQUIRE(stream.NextLine().m_line == longLine);
+        REQUIRE(stream.NextLine().m_line == "b");
+        REQUIRE(stream.Eof());
+    }
+}
@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Parsing/Sequence/SequenceDispatchIndex.h"
+#include "Parsing/Simple/SimpleParserValue.h"
+#include "Parsing/Simple/Matcher/SimpleMatcherFactory.h"
+#include "Parsing/Simple/Matcher/SimpleMatcherFirstTokens.h"
+
+namespace test::parsing::sequence::sequence_dispatch_index
+{
+    class TestState
+    {
+    };
+
+    typedef SequenceDispatchIndex<SimpleParserValue, TestState> index_t;
+    typedef index_t::sequence_t sequence_t;
+
+    class KeywordSequence final : public sequence_t
+    {
+    public:
+        KeywordSequence()
+        {
+            const SimpleMatcherFactory create(this);
+
+            AddMatchers({
+                create.KeywordIgnoreCase("itemDef"),
+                create.Char('{')
+            });
+        }
+
+    protected:
+        void ProcessMatch(TestState* state, SequenceResult<SimpleParserValue>& result) const override
+        {
+        }
+    };
+
+    class OptionalPrefixSequence final : public sequence_t
+    {
+    public:
+        OptionalPrefixSequence()
+        {
+            const SimpleMatcherFactory create(this);
+
+            AddMatchers({
+                create.Optional(create.Char('-')),
+                create.Integer()
+            });
+        }
+
+    protected:
+        void ProcessMatch(TestState* state, SequenceResult<SimpleParserValue>& result) const override
+        {
+        }
+    };
+
+    class AnythingSequence final : public sequence_t
+    {
+    public:
+        AnythingSequence()
+        {
+            const SimpleMatcherFactory create(this);
+
+            AddMatchers({
+                create.Optional(create.Identifier())
+            });
+        }
+
+    protected:
+        void ProcessMatch(TestState* state, SequenceResult<SimpleParserValue>& result) const override
+        {
+        }
+    };
+
+    std::vector<sequence_t*> GetCandidates(const index_t& index, const SimpleParserValue& token)
+    {
+        int type;
+        size_t value;
+        SimpleMatcherFirstTokens::GetTokenKey(token, type, value);
+
+        return index.GetCandidates(type, value);
+    }
+
+    TEST_CASE("SequenceDispatchIndex: Ensure only sequences that can start with a token are candidates", "[parsing][sequence]")
+    {
+        KeywordSequence keywordSequence;
+        OptionalPrefixSequence optionalPrefixSequence;
+        const std::vector<sequence_t*> sequences{&keywordSequence, &optionalPrefixSequence};
+        const index_t index(sequences);
+        const TokenPos pos;
+
+        REQUIRE(GetCandidates(index, SimpleParserValue::Identifier(pos, new std::string("ITEMDEF"))) == std::vector<sequence_t*>{&keywordSequence});
+        REQUIRE(GetCandidates(index, SimpleParserValue::Identifier(pos, new std::string("menuDef"))).empty());
+        REQUIRE(GetCandidates(index, SimpleParserValue::Character(pos, '-')) == std::vector<sequence_t*>{&optionalPrefixSequence});
+        REQUIRE(GetCandidates(index, SimpleParserValue::Integer(pos, 5)) == std::vector<sequence_t*>{&optionalPrefixSequence});
+        REQUIRE(GetCandidates(index, SimpleParserValue::Character(pos, '{')).empty());
+    }
+
+    TEST_CASE("SequenceDispatchIndex: Ensure sequences that can start with any token keep their order", "[parsing][sequence]")
+    {
+        AnythingSequence anythingSequence;
+        KeywordSequence keywordSequence;
+        const std::vector<sequence_t*> sequences{&anythingSequence, &keywordSequence};
+        const index_t index(sequences);
+        const TokenPos pos;
+
+        REQUIRE(GetCandidates(index, SimpleParserValue::Identifier(pos, new std::string("itemDef"))) == std::vector<sequence_t*>{&anythingSequence, &keywordSequence});
+        REQUIRE(GetCandidates(index, SimpleParserValue::Character(pos, ';')) == std::vector<sequence_t*>{&anythingSequence});
+    }
+}
@@ -9,6 +9,9 @@
 #include "Parsing/Mock/MockLexer.h"
 #include "Parsing/Simple/SimpleParserValue.h"
 #include "Parsing/Simple/Expression/ISimpleExpression.h"
+#include "Parsing/Simple/Expression/SimpleExpressionBytecode.h"
+#include "Parsing/Simple/Expression/SimpleExpressionConditionalOperator.h"
+#include "Parsing/Simple/Expression/SimpleExpressionScopeValue.h"
 #include "Parsing/Simple/Expression/SimpleExpressionMatchers.h"
 #include "Parsing/Simple/Matcher/SimpleMatcherFactory.h"
 
@@ -805,6 +808,46 @@ namespace test::parsing::simple::expression
         REQUIRE(value.m_int_value == 1337);
     }
 
+    TEST_CASE("SimpleExpressions: Bytecode can evaluate static parts of non static expressions", "[parsing][simple][expression]")
+    {
+        class ScopeValues final : public ISimpleExpressionScopeValues
+        {
+        public:
+            _NODISCARD SimpleExpressionValue ValueByName(const std::string& name) const override
+            {
+                return SimpleExpressionValue(name == "a" ? 10 : 0);
+            }
+        };
+
+        // a + (2 * 3 > 5 ? 4 : 1)
+        const auto expression = std::make_unique<SimpleExpressionBinaryOperation>(
+            &SimpleExpressionBinaryOperationType::OPERATION_ADD,
+            std::make_unique<SimpleExpressionScopeValue>("a"),
+            std::make_unique<SimpleExpressionConditionalOperator>(
+                std::make_unique<SimpleExpressionBinaryOperation>(
+                    &SimpleExpressionBinaryOperationType::OPERATION_GREATER_THAN,
+                    std::make_unique<SimpleExpressionBinaryOperation>(&SimpleExpressionBinaryOperationType::OPERATION_MULTIPLY,
+                                                                      std::make_unique<SimpleExpressionValue>(2),
+                                                                      std::make_unique<SimpleExpressionValue>(3)),
+                    std::make_unique<SimpleExpressionValue>(5)),
+                std::make_unique<SimpleExpressionValue>(4),
+                std::make_unique<SimpleExpressionValue>(1)));
+
+        const SimpleExpressionBytecode bytecode(expression.get());
+        REQUIRE(!bytecode.IsStatic());
+        REQUIRE(!bytecode.IsStatic(expression->m_operand1.get()));
+        REQUIRE(bytecode.IsStatic(expression->m_operand2.get()));
+
+        const auto staticValue = bytecode.EvaluateStatic(expression->m_operand2.get());
+        REQUIRE(staticValue.m_type == SimpleExpressionValue::Type::INT);
+        REQUIRE(staticValue.m_int_value == 4);
+
+        const ScopeValues scopeValues;
+        const auto value = bytecode.EvaluateNonStatic(&scopeValues);
+        REQUIRE(value.m_type == SimpleExpressionValue::Type::INT);
+        REQUIRE(value.m_int_value == 14);
+    }
+
     namespace it
     {
         TEST_CASE("SimpleExpressionsIT: Can parse subtraction without space", "[parsing][simple][expression][it]")
@@ -840,5 +883,34 @@ namespace test::parsing::simple::expression
             REQUIRE(value.m_type == SimpleExpressionValue::Type::INT);
             REQUIRE(value.m_int_value == 11);
         }
+    
+
+        TEST_CASE("SimpleExpressionsIT: Bytecode evaluates like the expression", "[parsing][simple][expression][it]")
+        {
+            const std::vector<std::string> expressions{
+                "1 + 2 * 3",
+                "5 > 3 ? \"yes\" : \"no\"",
+                "0 ? 1 + 1 : (2 ? 3 : 4)",
+                "!(4 & 5) || -7 < 2",
+                "1.5 * 2 + 3 % 2",
+            };
+
+            for (const auto& expressionString : expressions)
+            {
+                SimpleExpressionTestsHelper helper;
+                helper.String(expressionString);
+
+                const auto result = helper.PerformIntegrationTest();
+                REQUIRE(result);
+
+                const auto& expression = helper.m_state->m_expression;
+                const SimpleExpressionBytecode bytecode(expression.get());
+                REQUIRE(bytecode.IsStatic() == expression->IsStatic());
+
+                const auto expectedValue = expression->EvaluateStatic();
+                const auto value = bytecode.EvaluateStatic();
+                REQUIRE(value.Equals(&expectedValue));
+            }
+        }
     }
 }
@@ -0,0 +1,125 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <string>
+#include <vector>
+
+#include "Parsing/Mock/MockParserLineStream.h"
+#include "Parsing/Simple/SimpleLexer.h"
+
+namespace test::parsing::simple::lexer
+{
+    SimpleLexer::Config WholeInputConfig(const bool readWholeInput)
+    {
+        SimpleLexer::Config config;
+        config.m_read_whole_input = readWholeInput;
+        return config;
+    }
+
+    TEST_CASE("SimpleLexer: Reading whole input keeps line and column positions when consumed input is discarded", "[parsing][simple][lexer]")
+    {
+        const auto readWholeInput = GENERATE(false, true);
+
+        // Enough input for the lexer to discard the consumed part of its buffer several times
+        constexpr auto LINE_COUNT = 10000u;
+        std::vector<std::string> lines;
+        for (auto i = 0u; i < LINE_COUNT; i++)
+            lines.emplace_back(std::string(i % 7u, ' ') + "ident" + std::to_string(i) + " " + std::to_string(i) + ";");
+
+        MockParserLineStream mockStream(lines);
+        SimpleLexer lexer(&mockStream, WholeInputConfig(readWholeInput));
+
+        for (auto i = 0u; i < LINE_COUNT; i++)
+        {
+            const auto indent = static_cast<int>(i % 7u);
+            const auto identifier = "ident" + std::to_string(i);
+            const auto lineNumber = static_cast<int>(i + 1u);
+
+            const auto& identifierToken = lexer.GetToken(0);
+            REQUIRE(identifierToken.m_type == SimpleParserValueType::IDENTIFIER);
+            REQUIRE(identifierToken.IdentifierValue() == identifier);
+            REQUIRE(identifierToken.GetPos().m_line == lineNumber);
+            REQUIRE(identifierToken.GetPos().m_column == indent + 1);
+
+            const auto& integerToken = lexer.GetToken(1);
+            REQUIRE(integerToken.m_type == SimpleParserValueType::INTEGER);
+            REQUIRE(integerToken.IntegerValue() == static_cast<int>(i));
+            REQUIRE(integerToken.GetPos().m_line == lineNumber);
+            REQUIRE(integerToken.GetPos().m_column == indent + static_cast<int>(identifier.size()) + 2);
+
+            const auto& semicolonToken = lexer.GetToken(2);
+            REQUIRE(semicolonToken.m_type == SimpleParserValueType::CHARACTER);
+            REQUIRE(semicolonToken.CharacterValue() == ';');
+            REQUIRE(semicolonToken.GetPos().m_line == lineNumber);
+            REQUIRE(semicolonToken.GetPos().m_column == indent + static_cast<int>(identifier.size() + std::to_string(i).size()) + 2);
+
+            const auto line = lexer.GetLineForPos(identifierToken.GetPos());
+            REQUIRE(line.m_line == lines[i]);
+
+            lexer.PopTokens(3);
+        }
+
+        REQUIRE(lexer.IsEof());
+    }
+
+    TEST_CASE("SimpleLexer: Reading whole input keeps positions of tokens that are peeked across lines", "[parsing][simple][lexer]")
+    {
+        const std::vector<std::string> lines
+        {
+            "first",
+            "",
+            "   second third",
+            "fourth"
+        };
+
+        MockParserLineStream mockStream(lines);
+        SimpleLexer lexer(&mockStream, WholeInputConfig(true));
+
+        REQUIRE(lexer.GetToken(3).IdentifierValue() == "fourth");
+        REQUIRE(lexer.GetToken(3).GetPos().m_line == 4);
+        REQUIRE(lexer.GetToken(3).GetPos().m_column == 1);
+
+        REQUIRE(lexer.GetToken(0).IdentifierValue() == "first");
+        REQUIRE(lexer.GetToken(0).GetPos().m_line == 1);
+        REQUIRE(lexer.GetToken(0).GetPos().m_column == 1);
+
+        REQUIRE(lexer.GetToken(1).IdentifierValue() == "second");
+        REQUIRE(lexer.GetToken(1).GetPos().m_line == 3);
+        REQUIRE(lexer.GetToken(1).GetPos().m_column == 4);
+
+        REQUIRE(lexer.GetToken(2).IdentifierValue() == "third");
+        REQUIRE(lexer.GetToken(2).GetPos().m_line == 3);
+        REQUIRE(lexer.GetToken(2).GetPos().m_column == 11);
+
+        lexer.PopTokens(2);
+        REQUIRE(lexer.GetLineForPos(lexer.GetPos()).m_line == "   second third");
+    }
+
+    TEST_CASE("SimpleLexer: Reading whole input returns end of file when peeking past the end of the input", "[parsing][simple][lexer]")
+    {
+        const std::vector<std::string> lines
+        {
+            "value +"
+        };
+
+        MockParserLineStream mockStream(lines);
+        SimpleLexer lexer(&mockStream, WholeInputConfig(true));
+
+        REQUIRE(lexer.GetToken(5).IsEof());
+        REQUIRE(lexer.GetToken(4).IsEof());
+        REQUIRE(lexer.GetToken(3).IsEof());
+        REQUIRE(lexer.GetToken(2).IsEof());
+
+        // The sign has no number following it since the input ends right after it
+        REQUIRE(lexer.GetToken(1).m_type == SimpleParserValueType::CHARACTER);
+        REQUIRE(lexer.GetToken(1).CharacterValue() == '+');
+        REQUIRE(lexer.GetToken(1).GetPos().m_line == 1);
+        REQUIRE(lexer.GetToken(1).GetPos().m_column == 7);
+
+        REQUIRE(lexer.GetToken(0).IdentifierValue() == "value");
+
+        lexer.PopTokens(2);
+        REQUIRE(lexer.IsEof());
+        REQUIRE(lexer.GetToken(10).IsEof());
+    }
+}
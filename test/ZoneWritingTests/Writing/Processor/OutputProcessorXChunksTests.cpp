@@ -0,0 +1,191 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "Writing/Processor/OutputProcessorXChunks.h"
+#include "Zone/ZoneTypes.h"
+
+namespace test::writing::processor::xchunks
+{
+    class MockWritingStream final : public IWritingStream
+    {
+    public:
+        std::vector<uint8_t> m_data;
+
+        void Write(const void* buffer, const size_t length) override
+        {
+            const auto* bytes = static_cast<const uint8_t*>(buffer);
+            m_data.insert(m_data.end(), bytes, bytes + length);
+        }
+
+        void Flush() override
+        {
+        }
+
+        int64_t Pos() override
+        {
+            return static_cast<int64_t>(m_data.size());
+        }
+    };
+
+    /**
+     * \brief Puts the number of the stream in front of every chunk, so the stream a chunk was processed for can be told from the output.
+     */
+    class StreamNumberChunkProcessor final : public IXChunkProcessor
+    {
+    public:
+        size_t Process(const int streamNumber, const uint8_t* input, const size_t inputLength, uint8_t* output, const size_t outputBufferSize) override
+        {
+            // Chunks are processed on other threads where test assertions cannot be used
+            assert(inputLength + 1u <= outputBufferSize);
+
+            output[0] = static_cast<uint8_t>(streamNumber);
+            memcpy(&output[1], input, inputLength);
+
+            return inputLength + 1u;
+        }
+    };
+
+    class WrittenChunk
+    {
+    public:
+        int m_stream_number;
+        std::vector<uint8_t> m_data;
+    };
+
+    /**
+     * \brief Reads the chunks written by the processor. The size of a chunk may never span over the end of a vanilla buffer, the remainder of the buffer must be zero instead.
+     */
+    std::vector<WrittenChunk> ReadChunks(const std::vector<uint8_t>& data, size_t offset, const size_t vanillaBufferSize, size_t& paddingCount)
+    {
+        std::vector<WrittenChunk> chunks;
+        paddingCount = 0u;
+
+        while (offset < data.size())
+        {
+            if (vanillaBufferSize > 0 && offset % vanillaBufferSize + sizeof(xchunk_size_t) > vanillaBufferSize)
+            {
+                const auto paddingEnd = offset + vanillaBufferSize - offset % vanillaBufferSize;
+                REQUIRE(paddingEnd <= data.size());
+                for (; offset < paddingEnd; offset++)
+                    REQUIRE(data[offset] == 0u);
+
+                paddingCount++;
+            }
+
+            REQUIRE(offset + sizeof(xchunk_size_t) <= data.size());
+            xchunk_size_t chunkSize;
+            memcpy(&chunkSize, &data[offset], sizeof(chunkSize));
+            offset += sizeof(chunkSize);
+
+            REQUIRE(chunkSize > 0u);
+            REQUIRE(offset + chunkSize <= data.size());
+
+            WrittenChunk chunk;
+            chunk.m_stream_number = data[offset];
+            chunk.m_data.assign(data.begin() + static_cast<ptrdiff_t>(offset) + 1, data.begin() + static_cast<ptrdiff_t>(offset + chunkSize));
+            chunks.emplace_back(std::move(chunk));
+
+            offset += chunkSize;
+        }
+
+        return chunks;
+    }
+
+    std::vector<uint8_t> CreateTestData(const size_t size)
+    {
+        std::vector<uint8_t> data(size);
+        for (auto i = 0u; i < size; i++)
+            data[i] = static_cast<uint8_t>(i * 7u + 3u);
+
+        return data;
+    }
+
+    void WriteInParts(OutputProcessorXChunks& processor, const std::vector<uint8_t>& data)
+    {
+        // Writes of different sizes that do not line up with the chunks
+        size_t offset = 0u;
+        auto partSize = 1u;
+        while (offset < data.size())
+        {
+            const auto toWrite = std::min(static_cast<size_t>(partSize), data.size() - offset);
+            processor.Write(&data[offset], toWrite);
+            offset += toWrite;
+            partSize = partSize % 13u + 5u;
+        }
+
+        processor.Flush();
+    }
+
+    TEST_CASE("OutputProcessorXChunks: Chunks are written in order and processed for the stream they belong to", "[zonewriting][xchunks]")
+    {
+        constexpr auto STREAM_COUNT = 4;
+        constexpr auto CHUNK_WRITE_SIZE = 8u;
+
+        // Enough data for multiple rounds over all streams with a partial chunk at the end
+        const auto data = CreateTestData(CHUNK_WRITE_SIZE * 11u + 3u);
+
+        MockWritingStream baseStream;
+        OutputProcessorXChunks processor(STREAM_COUNT, CHUNK_WRITE_SIZE * 2u, CHUNK_WRITE_SIZE);
+        processor.AddChunkProcessor(std::make_unique<StreamNumberChunkProcessor>());
+        processor.SetBaseStream(&baseStream);
+
+        WriteInParts(processor, data);
+
+        size_t paddingCount;
+        const auto chunks = ReadChunks(baseStream.m_data, 0u, 0u, paddingCount);
+        REQUIRE(paddingCount == 0u);
+        REQUIRE(chunks.size() == 12u);
+
+        for (auto chunkIndex = 0u; chunkIndex < chunks.size(); chunkIndex++)
+        {
+            const auto& chunk = chunks[chunkIndex];
+            const auto dataOffset = chunkIndex * CHUNK_WRITE_SIZE;
+            const auto expectedSize = std::min(static_cast<size_t>(CHUNK_WRITE_SIZE), data.size() - dataOffset);
+
+            REQUIRE(chunk.m_stream_number == static_cast<int>(chunkIndex % STREAM_COUNT));
+            REQUIRE(chunk.m_data.size() == expectedSize);
+            REQUIRE(std::memcmp(chunk.m_data.data(), &data[dataOffset], expectedSize) == 0);
+        }
+    }
+
+    TEST_CASE("OutputProcessorXChunks: Chunk sizes that would span over the end of a vanilla buffer are moved to the next buffer", "[zonewriting][xchunks]")
+    {
+        constexpr auto STREAM_COUNT = 3;
+        constexpr auto CHUNK_WRITE_SIZE = 8u;
+        constexpr auto VANILLA_BUFFER_SIZE = 32u;
+
+        // The vanilla buffers start at the beginning of the file, not where the chunks start
+        constexpr auto HEADER_SIZE = 6u;
+        const std::vector<uint8_t> header(HEADER_SIZE, 0xFFu);
+
+        const auto data = CreateTestData(CHUNK_WRITE_SIZE * 20u + 5u);
+
+        MockWritingStream baseStream;
+        baseStream.Write(header.data(), header.size());
+
+        OutputProcessorXChunks processor(STREAM_COUNT, CHUNK_WRITE_SIZE * 2u, CHUNK_WRITE_SIZE, VANILLA_BUFFER_SIZE);
+        processor.AddChunkProcessor(std::make_unique<StreamNumberChunkProcessor>());
+        processor.SetBaseStream(&baseStream);
+
+        WriteInParts(processor, data);
+
+        size_t paddingCount;
+        const auto chunks = ReadChunks(baseStream.m_data, HEADER_SIZE, VANILLA_BUFFER_SIZE, paddingCount);
+        REQUIRE(paddingCount > 0u);
+        REQUIRE(chunks.size() == 21u);
+
+        std::vector<uint8_t> readData;
+        for (auto chunkIndex = 0u; chunkIndex < chunks.size(); chunkIndex++)
+        {
+            REQUIRE(chunks[chunkIndex].m_stream_number == static_cast<int>(chunkIndex % STREAM_COUNT));
+            readData.insert(readData.end(), chunks[chunkIndex].m_data.begin(), chunks[chunkIndex].m_data.end());
+        }
+
+        REQUIRE(readData == data);
+    }
+}